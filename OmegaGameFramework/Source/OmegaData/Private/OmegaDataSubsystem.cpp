@@ -35,16 +35,17 @@ void UOmegaDataSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 			Filter.bRecursivePaths = true;
 			AssetRegistryModule.Get().GetAssets(Filter, AssetData);
 
+			PrivateDataItems.Reserve(AssetData.Num());
+			DataItemOrder.Reserve(AssetData.Num());
 			for(FAssetData TempAssetData : AssetData)
 			{
-				if(Cast<UOmegaDataItem>(TempAssetData.GetAsset()))
+				if(UOmegaDataItem* TempItem = Cast<UOmegaDataItem>(TempAssetData.GetAsset()))
 				{
-					UOmegaDataItem* TempItem = Cast<UOmegaDataItem>(TempAssetData.GetAsset());
-					PrivateDataItems.AddUnique(TempItem);
-					if(TempItem->GameplayID.IsValid())
+					if(DataItemOrder.Contains(TempItem))
 					{
-						DataItemIDs.Add(TempItem->GameplayID, TempItem);
+						continue;
 					}
+					local_RegisterDataItem(TempItem);
 					FString label=TempItem->GetName();
 					if(!TempItem->CustomLabel.IsEmpty())
 					{
@@ -58,115 +59,155 @@ void UOmegaDataSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 }
 
-
-TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItems()
+void UOmegaDataSubsystem::local_RegisterDataItem(UOmegaDataItem* Item)
 {
-	TArray<UOmegaDataItem*> LocalItems;
-	for(auto TempItem : PrivateDataItems)
+	DataItemOrder.Add(Item, PrivateDataItems.Add(Item));
+	if(Item->GameplayID.IsValid())
 	{
-		if(TempItem)
+		DataItemIDs.Add(Item->GameplayID, Item);
+	}
+
+	// Categories are filed under the exact tag and every parent for hierarchy matches.
+	const FGameplayTag CategoryTag = IGameplayTagsInterface::Execute_GetObjectGameplayCategory(Item);
+	if(CategoryTag.IsValid())
+	{
+		ItemsByCategory.FindOrAdd(CategoryTag).Items.Add(Item);
+		for(const FGameplayTag& TempTag : CategoryTag.GetGameplayTagParents())
 		{
-			LocalItems.Add(TempItem);
+			ItemsByCategoryTree.FindOrAdd(TempTag).Items.Add(Item);
 		}
 	}
-	return LocalItems;
-}
 
-UOmegaDataItem* UOmegaDataSubsystem::GetDataItemOfID(FGameplayTag ID)
-{
-	if(DataItemIDs.Contains(ID))
+	const FGameplayTagContainer ItemTags = IGameplayTagsInterface::Execute_GetObjectGameplayTags(Item);
+	for(const FGameplayTag& TempTag : ItemTags)
 	{
-		return DataItemIDs[ID];
+		ItemsByTag.FindOrAdd(TempTag).Items.Add(Item);
+	}
+	for(const FGameplayTag& TempTag : ItemTags.GetGameplayTagParents())
+	{
+		ItemsByTagTree.FindOrAdd(TempTag).Items.Add(Item);
 	}
-	return nullptr;
-}
 
-TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsOfCategory(FGameplayTag CategoryTag, bool Exact)
-{
-	TArray<UOmegaDataItem*> LocalItems;
-	for(auto TempItem : GetAllDataItems())
+	TSet<UClass*> TraitClasses;
+	for(const UOmegaDataTrait* TempTrait : Item->GetAllValidTraits())
 	{
-		if(TempItem)
+		bool bAlreadyIndexed;
+		TraitClasses.Add(TempTrait->GetClass(), &bAlreadyIndexed);
+		if(!bAlreadyIndexed)
 		{
-			bool bIsMatch;
-			FGameplayTag TargetTag = IGameplayTagsInterface::Execute_GetObjectGameplayCategory(TempItem);
-			if(Exact)
-			{
-				bIsMatch = TargetTag.MatchesTagExact(CategoryTag);
-			}
-			else
-			{
-				bIsMatch = TargetTag.MatchesTag(CategoryTag);
-			}
-
-			if (bIsMatch)
-			{
-				LocalItems.AddUnique(TempItem);
-			}
+			ItemsByTraitClass.FindOrAdd(TempTrait->GetClass()).Items.Add(Item);
 		}
 	}
-	return LocalItems;
 }
 
-TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithTags(FGameplayTagContainer Tags, bool Exact)
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::local_GatherItems(const TMap<FGameplayTag, FOmegaDataItemBucket>& Index, const FGameplayTagContainer& Keys) const
 {
 	TArray<UOmegaDataItem*> LocalItems;
-	for(auto TempItem : GetAllDataItems())
+	if(Keys.Num() == 1)
 	{
-		if(TempItem)
+		if(const FOmegaDataItemBucket* Bucket = Index.Find(Keys.First()))
 		{
-			bool bIsMatch;
-			FGameplayTagContainer TargetTag = IGameplayTagsInterface::Execute_GetObjectGameplayTags(TempItem);
-			if(Exact)
-			{
-				bIsMatch = TargetTag.HasAnyExact(Tags);
-			}
-			else
-			{
-				bIsMatch = TargetTag.HasAny(Tags);
-			}
+			LocalItems = Bucket->Items;
+		}
+		return LocalItems;
+	}
 
-			if (bIsMatch)
+	TSet<UOmegaDataItem*> FoundItems;
+	for(const FGameplayTag& TempTag : Keys)
+	{
+		if(const FOmegaDataItemBucket* Bucket = Index.Find(TempTag))
+		{
+			for(UOmegaDataItem* TempItem : Bucket->Items)
 			{
-				LocalItems.AddUnique(TempItem);
+				bool bAlreadyFound;
+				FoundItems.Add(TempItem, &bAlreadyFound);
+				if(!bAlreadyFound)
+				{
+					LocalItems.Add(TempItem);
+				}
 			}
 		}
 	}
+	local_SortByRegistration(LocalItems);
 	return LocalItems;
 }
 
-TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithTrait(TSubclassOf<UOmegaDataTrait> Trait)
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::local_GatherTraitItems(TFunctionRef<bool(const UClass*)> Predicate) const
 {
 	TArray<UOmegaDataItem*> LocalItems;
-	for(auto TempItem : GetAllDataItems())
+	TSet<UOmegaDataItem*> FoundItems;
+	for(const TPair<UClass*, FOmegaDataItemBucket>& Pair : ItemsByTraitClass)
 	{
-		if(TempItem)
+		if(Pair.Key && Predicate(Pair.Key))
 		{
-			if(TempItem->GetTraitByType(Trait))
+			for(UOmegaDataItem* TempItem : Pair.Value.Items)
 			{
-				LocalItems.AddUnique(TempItem);
+				bool bAlreadyFound;
+				FoundItems.Add(TempItem, &bAlreadyFound);
+				if(!bAlreadyFound)
+				{
+					LocalItems.Add(TempItem);
+				}
 			}
 		}
 	}
+	local_SortByRegistration(LocalItems);
 	return LocalItems;
 }
 
-TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithInterface(TSubclassOf<UInterface> Interface)
+void UOmegaDataSubsystem::local_SortByRegistration(TArray<UOmegaDataItem*>& Items) const
+{
+	// Keep results in registration order, like a scan over all items would.
+	Items.Sort([this](const UOmegaDataItem& A, const UOmegaDataItem& B)
+	{
+		return DataItemOrder.FindRef(&A) < DataItemOrder.FindRef(&B);
+	});
+}
+
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItems()
 {
 	TArray<UOmegaDataItem*> LocalItems;
-	for(auto TempItem : GetAllDataItems())
+	for(auto TempItem : PrivateDataItems)
 	{
 		if(TempItem)
 		{
-			if(TempItem->GetTraitWithInterface(Interface))
-			{
-				LocalItems.AddUnique(TempItem);
-			}
+			LocalItems.Add(TempItem);
 		}
 	}
 	return LocalItems;
 }
 
+UOmegaDataItem* UOmegaDataSubsystem::GetDataItemOfID(FGameplayTag ID)
+{
+	if(DataItemIDs.Contains(ID))
+	{
+		return DataItemIDs[ID];
+	}
+	return nullptr;
+}
+
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsOfCategory(FGameplayTag CategoryTag, bool Exact)
+{
+	return local_GatherItems(Exact ? ItemsByCategory : ItemsByCategoryTree, FGameplayTagContainer(CategoryTag));
+}
+
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithTags(FGameplayTagContainer Tags, bool Exact)
+{
+	return local_GatherItems(Exact ? ItemsByTag : ItemsByTagTree, Tags);
+}
+
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithTrait(TSubclassOf<UOmegaDataTrait> Trait)
+{
+	UClass* TraitClass = Trait.Get();
+	return local_GatherTraitItems([TraitClass](const UClass* TempClass){ return TempClass->IsChildOf(TraitClass); });
+}
+
+TArray<UOmegaDataItem*> UOmegaDataSubsystem::GetAllDataItemsWithInterface(TSubclassOf<UInterface> Interface)
+{
+	UClass* InterfaceClass = Interface.Get();
+	return local_GatherTraitItems([InterfaceClass](const UClass* TempClass){ return TempClass->ImplementsInterface(InterfaceClass); });
+}
+
 UOmegaDataItem* UOmegaDataSubsystem::GetDataItemFromName(const FString& Name)
 {
 	if(NamedItems.Contains(Name))
@@ -196,12 +237,21 @@ UOmegaDataItem* UOmegaDataSubsystem::CreateDataItemFromString(FString StringData
 		TempConstructor->OnItemCreated(StringData, NewItem->DisplayName,NewItem->DisplayDescription,NewItem->Icon,NewItem->GameplayCategory,NewItem->GameplayTags);
 
 		NamedItems.Add(ItemName, NewItem);
+		local_RegisterDataItem(NewItem);
 	
 		return NewItem;
 	}
 	return nullptr;
 }
 
+void UOmegaDataSubsystem::Native_RegisterDataItem(UOmegaDataItem* Item)
+{
+	if(Item && !DataItemOrder.Contains(Item))
+	{
+		local_RegisterDataItem(Item);
+	}
+}
+
 void UOmegaDataSubsystem::RegisterDataComponent(UDataItemComponent* NewComponent)
 {
 	Local_DataComponentList.AddUnique(NewComponent);
@@ -0,0 +1,169 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "OmegaDataSubsystem.h"
+#include "OmegaDataItem.h"
+#include "OmegaDataTrait.h"
+#include "Engine/GameInstance.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "NativeGameplayTags.h"
+#include "UObject/UObjectIterator.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOmegaDataIndexBenchmark, "OmegaData.DataItems.IndexBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace OmegaDataIndexBenchmark
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_A, "OmegaBenchmark.Category.A");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_B, "OmegaBenchmark.Category.B");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_C, "OmegaBenchmark.Category.C");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_D, "OmegaBenchmark.Category.D");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_E, "OmegaBenchmark.Category.E");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_F, "OmegaBenchmark.Category.F");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_G, "OmegaBenchmark.Category.G");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Category_H, "OmegaBenchmark.Category.H");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_A, "OmegaBenchmark.Tag.A");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_B, "OmegaBenchmark.Tag.B");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_C, "OmegaBenchmark.Tag.C");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_D, "OmegaBenchmark.Tag.D");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_E, "OmegaBenchmark.Tag.E");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_F, "OmegaBenchmark.Tag.F");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_G, "OmegaBenchmark.Tag.G");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Tag_H, "OmegaBenchmark.Tag.H");
+
+	constexpr int32 NumItems=50000;
+
+	// The scans the subsystem ran before it had indexes: every item checked, results added with AddUnique.
+	TArray<UOmegaDataItem*> local_ScanCategory(UOmegaDataSubsystem* Subsystem, const FGameplayTag& CategoryTag, bool bExact)
+	{
+		TArray<UOmegaDataItem*> LocalItems;
+		for(auto TempItem : Subsystem->GetAllDataItems())
+		{
+			const FGameplayTag TargetTag=IGameplayTagsInterface::Execute_GetObjectGameplayCategory(TempItem);
+			if(bExact ? TargetTag.MatchesTagExact(CategoryTag) : TargetTag.MatchesTag(CategoryTag))
+			{
+				LocalItems.AddUnique(TempItem);
+			}
+		}
+		return LocalItems;
+	}
+
+	TArray<UOmegaDataItem*> local_ScanTags(UOmegaDataSubsystem* Subsystem, const FGameplayTagContainer& Tags, bool bExact)
+	{
+		TArray<UOmegaDataItem*> LocalItems;
+		for(auto TempItem : Subsystem->GetAllDataItems())
+		{
+			const FGameplayTagContainer TargetTags=IGameplayTagsInterface::Execute_GetObjectGameplayTags(TempItem);
+			if(bExact ? TargetTags.HasAnyExact(Tags) : TargetTags.HasAny(Tags))
+			{
+				LocalItems.AddUnique(TempItem);
+			}
+		}
+		return LocalItems;
+	}
+
+	TArray<UOmegaDataItem*> local_ScanTrait(UOmegaDataSubsystem* Subsystem, TSubclassOf<UOmegaDataTrait> Trait)
+	{
+		TArray<UOmegaDataItem*> LocalItems;
+		for(auto TempItem : Subsystem->GetAllDataItems())
+		{
+			if(TempItem->GetTraitByType(Trait))
+			{
+				LocalItems.AddUnique(TempItem);
+			}
+		}
+		return LocalItems;
+	}
+
+	double local_Milliseconds(double StartTime)
+	{
+		return (FPlatformTime::Seconds()-StartTime)*1000.0;
+	}
+}
+
+bool FOmegaDataIndexBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OmegaDataIndexBenchmark;
+
+	const FGameplayTag Categories[]={ TAG_Category_A, TAG_Category_B, TAG_Category_C, TAG_Category_D, TAG_Category_E, TAG_Category_F, TAG_Category_G, TAG_Category_H };
+	const FGameplayTag Tags[]={ TAG_Tag_A, TAG_Tag_B, TAG_Tag_C, TAG_Tag_D, TAG_Tag_E, TAG_Tag_F, TAG_Tag_G, TAG_Tag_H };
+
+	// Concrete native traits, if any module in this build has them.
+	TArray<UClass*> TraitClasses;
+	for(TObjectIterator<UClass> It; It && TraitClasses.Num()<4; ++It)
+	{
+		if(It->IsChildOf(UOmegaDataTrait::StaticClass()) && It->IsNative() && !It->HasAnyClassFlags(CLASS_Abstract|CLASS_Deprecated|CLASS_NewerVersionExists))
+		{
+			TraitClasses.Add(*It);
+		}
+	}
+
+	// A standalone subsystem, so the project's own data items are not scanned.
+	UGameInstance* GameInstance=NewObject<UGameInstance>(GetTransientPackage());
+	GameInstance->AddToRoot();
+	UOmegaDataSubsystem* DataSubsystem=NewObject<UOmegaDataSubsystem>(GameInstance);
+
+	FRandomStream Random(1337);
+	double StartTime=FPlatformTime::Seconds();
+	for(int32 i=0; i<NumItems; ++i)
+	{
+		UOmegaDataItem* NewItem=NewObject<UOmegaDataItem>(DataSubsystem);
+		NewItem->GameplayCategory=Categories[Random.RandRange(0,UE_ARRAY_COUNT(Categories)-1)];
+		NewItem->GameplayTags.AddTag(Tags[Random.RandRange(0,UE_ARRAY_COUNT(Tags)-1)]);
+		NewItem->GameplayTags.AddTag(Tags[Random.RandRange(0,UE_ARRAY_COUNT(Tags)-1)]);
+		if(TraitClasses.Num()>0 && Random.FRand()<0.25f)
+		{
+			NewItem->Traits.Add(NewObject<UOmegaDataTrait>(NewItem,TraitClasses[Random.RandRange(0,TraitClasses.Num()-1)]));
+		}
+		DataSubsystem->Native_RegisterDataItem(NewItem);
+	}
+	AddInfo(FString::Printf(TEXT("Registered %d items with indexes: %.2f ms"),NumItems,local_Milliseconds(StartTime)));
+
+	const auto CompareQuery=[this](const TCHAR* Label, TFunctionRef<TArray<UOmegaDataItem*>()> Scan, TFunctionRef<TArray<UOmegaDataItem*>()> Indexed)
+	{
+		double QueryStart=FPlatformTime::Seconds();
+		const TArray<UOmegaDataItem*> ScanResult=Scan();
+		const double ScanTime=local_Milliseconds(QueryStart);
+		QueryStart=FPlatformTime::Seconds();
+		const TArray<UOmegaDataItem*> IndexedResult=Indexed();
+		const double IndexedTime=local_Milliseconds(QueryStart);
+		AddInfo(FString::Printf(TEXT("%s: scan %.3f ms, index %.3f ms, %d items"),Label,ScanTime,IndexedTime,IndexedResult.Num()));
+		TestTrue(FString::Printf(TEXT("%s returns the scan's items in the scan's order"),Label),ScanResult==IndexedResult);
+	};
+
+	const FGameplayTag ParentCategory=FGameplayTag::RequestGameplayTag(TEXT("OmegaBenchmark.Category"));
+	CompareQuery(TEXT("Category (exact)"),
+		[&](){ return local_ScanCategory(DataSubsystem,TAG_Category_A,true); },
+		[&](){ return DataSubsystem->GetAllDataItemsOfCategory(TAG_Category_A,true); });
+	CompareQuery(TEXT("Category (parent)"),
+		[&](){ return local_ScanCategory(DataSubsystem,ParentCategory,false); },
+		[&](){ return DataSubsystem->GetAllDataItemsOfCategory(ParentCategory,false); });
+
+	FGameplayTagContainer QueryTags;
+	QueryTags.AddTag(TAG_Tag_A);
+	QueryTags.AddTag(TAG_Tag_B);
+	CompareQuery(TEXT("Tags (exact, any of 2)"),
+		[&](){ return local_ScanTags(DataSubsystem,QueryTags,true); },
+		[&](){ return DataSubsystem->GetAllDataItemsWithTags(QueryTags,true); });
+
+	if(TraitClasses.Num()>0)
+	{
+		UClass* TraitClass=TraitClasses[0];
+		CompareQuery(TEXT("Trait"),
+			[&](){ return local_ScanTrait(DataSubsystem,TraitClass); },
+			[&](){ return DataSubsystem->GetAllDataItemsWithTrait(TraitClass); });
+	}
+	else
+	{
+		AddInfo(TEXT("No concrete native data traits are loaded, the trait query was not measured."));
+	}
+
+	GameInstance->RemoveFromRoot();
+	return true;
+}
+
+#endif
@@ -12,6 +12,14 @@
 class UOmegaDataItem;
 class UWorld;
 
+USTRUCT()
+struct FOmegaDataItemBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<UOmegaDataItem*> Items;
+};
+
 UCLASS(DisplayName="Omega Subsystem: Data Items")
 class OMEGADATA_API UOmegaDataSubsystem : public UGameInstanceSubsystem
 {
@@ -22,6 +30,19 @@ class OMEGADATA_API UOmegaDataSubsystem : public UGameInstanceSubsystem
 	UPROPERTY() TArray<UOmegaDataItem*> PrivateDataItems;
 	UPROPERTY() TMap<FString,UOmegaDataItem*> NamedItems;
 	UPROPERTY() TMap<FGameplayTag, UOmegaDataItem*> DataItemIDs;
+
+	//Lookup indexes, filled when an item is registered.
+	UPROPERTY() TMap<UOmegaDataItem*, int32> DataItemOrder;
+	UPROPERTY() TMap<FGameplayTag, FOmegaDataItemBucket> ItemsByCategory;
+	UPROPERTY() TMap<FGameplayTag, FOmegaDataItemBucket> ItemsByCategoryTree;
+	UPROPERTY() TMap<FGameplayTag, FOmegaDataItemBucket> ItemsByTag;
+	UPROPERTY() TMap<FGameplayTag, FOmegaDataItemBucket> ItemsByTagTree;
+	UPROPERTY() TMap<UClass*, FOmegaDataItemBucket> ItemsByTraitClass;
+
+	void local_RegisterDataItem(UOmegaDataItem* Item);
+	TArray<UOmegaDataItem*> local_GatherItems(const TMap<FGameplayTag, FOmegaDataItemBucket>& Index, const FGameplayTagContainer& Keys) const;
+	TArray<UOmegaDataItem*> local_GatherTraitItems(TFunctionRef<bool(const UClass*)> Predicate) const;
+	void local_SortByRegistration(TArray<UOmegaDataItem*>& Items) const;
 public:
 
 	//###########################################################################################
@@ -50,6 +71,9 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="OmegaDataSubsytem")
 	UOmegaDataItem* CreateDataItemFromString(FString StringData,TSubclassOf<UOmegaDataItemConstructor> ConstructorClass, FString ItemName);
+
+	//Adds an item that was not found by the asset scan to the lookup indexes. Items already registered are skipped.
+	void Native_RegisterDataItem(UOmegaDataItem* Item);
 	
 	//###########################################################################################
 	// DATA Component
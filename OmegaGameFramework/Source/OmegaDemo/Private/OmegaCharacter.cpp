@@ -103,7 +103,7 @@ void AOmegaCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComp
 
 void AOmegaCharacter::Local_LevelUpdate(int32 NewLevel)
 {
-	Combatant->Level = Leveling->GetCurrentLevel();
+	Combatant->SetLevel(Leveling->GetCurrentLevel());
 }
 
 void AOmegaCharacter::Local_UpdateDataItem(UOmegaDataItem* NewItem)
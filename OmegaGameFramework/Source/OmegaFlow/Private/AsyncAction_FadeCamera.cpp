@@ -6,22 +6,30 @@
 #include "Subsystems/OmegaSubsystem_GameManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-
-void UAsyncAction_FadeCamera::Tick(float DeltaTime)
-{
-	if(PlayerRef && PlayerRef->PlayerCameraManager->FadeAmount == TargetFadeState && !LocalIsFinishing)
-	{
-		LocalIsFinishing = true;
-		Finished.Broadcast();
-		SetReadyToDestroy();
-	}
-}
+#include "Engine/GameInstance.h"
+#include "Subsystems/OmegaSubsystem_Tween.h"
 
 void UAsyncAction_FadeCamera::Activate()
 {
-	if(PlayerRef)
+	UGameInstance* GameInstance = local_WorldContext && local_WorldContext->GetWorld() ? local_WorldContext->GetWorld()->GetGameInstance() : nullptr;
+	if(PlayerRef && GameInstance)
 	{
 		PlayerRef->PlayerCameraManager->StartCameraFade(PlayerRef->PlayerCameraManager->FadeAmount, TargetFadeState, TargetDuration, TargetFadeColor, Local_FadeAudio, Local_HoldOnFinish);
+
+		TWeakObjectPtr<UAsyncAction_FadeCamera> WeakThis(this);
+		GameInstance->GetSubsystem<UOmegaTweenSubsystem>()->Native_WaitUntil(this, [WeakThis]()
+		{
+			return WeakThis.IsValid() && WeakThis->PlayerRef && WeakThis->PlayerRef->PlayerCameraManager->FadeAmount == WeakThis->TargetFadeState;
+		},
+		[WeakThis]()
+		{
+			if(WeakThis.IsValid() && !WeakThis->LocalIsFinishing)
+			{
+				WeakThis->LocalIsFinishing = true;
+				WeakThis->Finished.Broadcast();
+				WeakThis->SetReadyToDestroy();
+			}
+		});
 	}
 	else
 	{
@@ -50,6 +58,8 @@ UAsyncAction_FadeCamera* UAsyncAction_FadeCamera::FadeCameraAsync(UObject* World
 	NewNode->Local_HoldOnFinish = HoldWhenFinished;
 	NewNode->Local_FadeAudio = FadeAudio;
 	NewNode->TargetDuration = Duration;
+	NewNode->local_WorldContext = WorldContextObject;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
 
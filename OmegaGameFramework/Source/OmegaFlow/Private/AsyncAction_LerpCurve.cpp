@@ -3,48 +3,47 @@
 
 #include "AsyncAction_LerpCurve.h"
 #include "Engine/World.h"
-
-
-void UAsyncAction_LerpCurve::Tick(float DeltaTime)
-{
-	if (local_playing)
-	{
-		local_reversed ? elapsed_time -= DeltaTime * local_PlayRate : elapsed_time += DeltaTime * local_PlayRate;
-        
-		if (local_curve)
-		{
-			new_value = local_curve->GetFloatValue(elapsed_time);
-		}
-        
-		bool should_end = local_reversed ? (elapsed_time <= 0) : (elapsed_time >= time_max); // Assuming BlendDuration is the end time
-
-		if (should_end)
-		{
-			local_playing = false;
-			Finished.Broadcast(); // Make sure delegate is valid
-			SetReadyToDestroy();
-		}
-		else
-		{
-			Updated.Broadcast(new_value); // Make sure delegate is valid
-		}
-	}
-}
+#include "Engine/GameInstance.h"
+#include "Subsystems/OmegaSubsystem_Tween.h"
 
 
 void UAsyncAction_LerpCurve::Activate()
 {
-	if(local_curve && local_PlayRate>0.0f)
+	UGameInstance* GameInstance = local_WorldContext && local_WorldContext->GetWorld() ? local_WorldContext->GetWorld()->GetGameInstance() : nullptr;
+	if(local_curve && local_PlayRate>0.0f && GameInstance)
 	{
+		float time_min;
+		float time_max;
 		local_curve->GetTimeRange(time_min,time_max);
-		
-		elapsed_time=0.0;
-		if(local_reversed)
+
+		FOmegaTween NewTween;
+		NewTween.Curve = local_curve;
+		NewTween.EndTime = time_max;
+		NewTween.Time = local_reversed ? time_max : 0.0f;
+		NewTween.PlayRate = local_PlayRate;
+		NewTween.bReversed = local_reversed;
+		NewTween.PauseGroup = local_PauseGroup;
+		NewTween.bTickWhenPaused = true;
+		NewTween.World = local_WorldContext->GetWorld();
+		NewTween.Owner = this;
+
+		TWeakObjectPtr<UAsyncAction_LerpCurve> WeakThis(this);
+		NewTween.OnUpdate = [WeakThis](float Value)
+		{
+			if(WeakThis.IsValid())
+			{
+				WeakThis->Updated.Broadcast(Value);
+			}
+		};
+		NewTween.OnFinished = [WeakThis]()
 		{
-			elapsed_time=time_max;
-		}
-		
-		local_playing=true;
+			if(WeakThis.IsValid())
+			{
+				WeakThis->Finished.Broadcast();
+				WeakThis->SetReadyToDestroy();
+			}
+		};
+		GameInstance->GetSubsystem<UOmegaTweenSubsystem>()->Native_AddTween(MoveTemp(NewTween));
 	}
 	else
 	{
@@ -53,12 +52,15 @@ void UAsyncAction_LerpCurve::Activate()
 }
 
 UAsyncAction_LerpCurve* UAsyncAction_LerpCurve::LerpAlongCurve(UObject* WorldContextObject, UCurveFloat* Curve,
-	float PlayRate, bool bReverse)
+	float PlayRate, bool bReverse, FName PauseGroup)
 {
 	UAsyncAction_LerpCurve* NewNode = NewObject<UAsyncAction_LerpCurve>();
+	NewNode->local_WorldContext = WorldContextObject;
 	NewNode->local_curve=Curve;
 	NewNode->local_PlayRate=PlayRate;
 	NewNode->local_reversed = bReverse;
+	NewNode->local_PauseGroup = PauseGroup;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
 
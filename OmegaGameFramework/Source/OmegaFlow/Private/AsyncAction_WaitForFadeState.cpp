@@ -6,15 +6,32 @@
 #include "Subsystems/OmegaSubsystem_GameManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/GameInstance.h"
+#include "Subsystems/OmegaSubsystem_Tween.h"
 
-void UAsyncAction_WaitForFadeState::Tick(float DeltaTime)
+void UAsyncAction_WaitForFadeState::Activate()
 {
-	if(PlayerRef && PlayerRef->PlayerCameraManager->FadeAmount == TargetFadeState && !LocalIsFinishing)
+	UGameInstance* GameInstance = local_WorldContext && local_WorldContext->GetWorld() ? local_WorldContext->GetWorld()->GetGameInstance() : nullptr;
+	if(!PlayerRef || !GameInstance)
 	{
-		LocalIsFinishing = true;
-		Finished.Broadcast();
 		SetReadyToDestroy();
+		return;
 	}
+
+	TWeakObjectPtr<UAsyncAction_WaitForFadeState> WeakThis(this);
+	GameInstance->GetSubsystem<UOmegaTweenSubsystem>()->Native_WaitUntil(this, [WeakThis]()
+	{
+		return WeakThis.IsValid() && WeakThis->PlayerRef && WeakThis->PlayerRef->PlayerCameraManager->FadeAmount == WeakThis->TargetFadeState;
+	},
+	[WeakThis]()
+	{
+		if(WeakThis.IsValid() && !WeakThis->LocalIsFinishing)
+		{
+			WeakThis->LocalIsFinishing = true;
+			WeakThis->Finished.Broadcast();
+			WeakThis->SetReadyToDestroy();
+		}
+	});
 }
 
 UAsyncAction_WaitForFadeState* UAsyncAction_WaitForFadeState::WaitForFadeState(UObject* WorldContextObject,
@@ -33,5 +50,7 @@ UAsyncAction_WaitForFadeState* UAsyncAction_WaitForFadeState::WaitForFadeState(U
 	UAsyncAction_WaitForFadeState* NewMenuNode = NewObject<UAsyncAction_WaitForFadeState>();
 	NewMenuNode->PlayerRef = TempPlayer;
 	NewMenuNode->TargetFadeState = FadeState;
+	NewMenuNode->local_WorldContext = WorldContextObject;
+	NewMenuNode->RegisterWithGameInstance(WorldContextObject);
 	return NewMenuNode;
 }
@@ -7,10 +7,14 @@
 #include "Subsystems/OmegaSubsystem_GameManager.h"
 
 
-void UAsyncAction_WaitForFlag::Native_OnFlagEvent(FString Flag, bool State)
+void UAsyncAction_WaitForFlag::Native_OnFlagChanged(bool State)
 {
-	if(Flag==Local_Flag && State==Local_State)
+	if(State==Local_State)
 	{
+		if(LocalWorldContext && LocalWorldContext->GetWorld())
+		{
+			LocalWorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaGameManager>()->Native_OnFlagChanged(FName(*Local_Flag)).Remove(FlagListenerHandle);
+		}
 		Local_Finish();
 	}
 }
@@ -30,7 +34,7 @@ void UAsyncAction_WaitForFlag::Activate()
 	}
 	else
 	{
-		SubsystemRef->OnFlagStateChange.AddDynamic(this, &UAsyncAction_WaitForFlag::Native_OnFlagEvent);
+		FlagListenerHandle = SubsystemRef->Native_OnFlagChanged(FName(*Local_Flag)).AddUObject(this, &UAsyncAction_WaitForFlag::Native_OnFlagChanged);
 	}
 	
 }
@@ -42,5 +46,6 @@ UAsyncAction_WaitForFlag* UAsyncAction_WaitForFlag::WaitForFlagState(UObject* Wo
 	NewNode->Local_Flag = Flag;
 	NewNode->Local_State = bState;
 	NewNode->LocalWorldContext = WorldContextObject;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
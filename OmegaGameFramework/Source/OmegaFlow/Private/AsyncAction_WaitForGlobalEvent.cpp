@@ -11,19 +11,20 @@
 // Name
 // ==============================================
 
-void UAsyncAction_WaitForGlobalEvent::Native_OnEvent(FName Event, UObject* Context)
+void UAsyncAction_WaitForGlobalEvent::Native_OnEvent(UObject* Context)
 {
-	if(Event == EventRef)
+	if(LocalWorldContext && LocalWorldContext->GetWorld())
 	{
-		OnReceiveEvent.Broadcast(Context);
-		SetReadyToDestroy();
+		LocalWorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaGameManager>()->Native_OnGlobalEvent(EventRef).Remove(EventListenerHandle);
 	}
+	OnReceiveEvent.Broadcast(Context);
+	SetReadyToDestroy();
 }
 
 void UAsyncAction_WaitForGlobalEvent::Activate()
 {
 	UOmegaGameManager* SubsystemRef = LocalWorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaGameManager>();
-	SubsystemRef->OnGlobalEvent.AddDynamic(this, &UAsyncAction_WaitForGlobalEvent::Native_OnEvent);
+	EventListenerHandle = SubsystemRef->Native_OnGlobalEvent(EventRef).AddUObject(this, &UAsyncAction_WaitForGlobalEvent::Native_OnEvent);
 }
 
 UAsyncAction_WaitForGlobalEvent* UAsyncAction_WaitForGlobalEvent::WaitForGlobalEvent(const UObject* WorldContextObject, FName Event)
@@ -31,6 +32,7 @@ UAsyncAction_WaitForGlobalEvent* UAsyncAction_WaitForGlobalEvent::WaitForGlobalE
 	UAsyncAction_WaitForGlobalEvent* NewNode = NewObject<UAsyncAction_WaitForGlobalEvent>();
 	NewNode->EventRef = Event;
 	NewNode->LocalWorldContext = WorldContextObject;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
 
@@ -39,19 +41,20 @@ UAsyncAction_WaitForGlobalEvent* UAsyncAction_WaitForGlobalEvent::WaitForGlobalE
 // Tagged
 // ==============================================
 
-void UAsyncAction_WaitForTaggedGlobalEvent::Native_OnEvent(FGameplayTag Event, UObject* Context)
+void UAsyncAction_WaitForTaggedGlobalEvent::Native_OnEvent(UObject* Context)
 {
-	if(Event == EventRef)
+	if(LocalWorldContext && LocalWorldContext->GetWorld())
 	{
-		OnReceiveEvent.Broadcast(Context);
-		SetReadyToDestroy();
+		LocalWorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaGameManager>()->Native_OnTaggedGlobalEvent(EventRef).Remove(EventListenerHandle);
 	}
+	OnReceiveEvent.Broadcast(Context);
+	SetReadyToDestroy();
 }
 
 void UAsyncAction_WaitForTaggedGlobalEvent::Activate()
 {
 	UOmegaGameManager* SubsystemRef = LocalWorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaGameManager>();
-	SubsystemRef->OnTaggedGlobalEvent.AddDynamic(this, &UAsyncAction_WaitForTaggedGlobalEvent::Native_OnEvent);
+	EventListenerHandle = SubsystemRef->Native_OnTaggedGlobalEvent(EventRef).AddUObject(this, &UAsyncAction_WaitForTaggedGlobalEvent::Native_OnEvent);
 }
 
 UAsyncAction_WaitForTaggedGlobalEvent* UAsyncAction_WaitForTaggedGlobalEvent::WaitForTaggedGlobalEvent(const UObject* WorldContextObject, FGameplayTag Event)
@@ -59,5 +62,6 @@ UAsyncAction_WaitForTaggedGlobalEvent* UAsyncAction_WaitForTaggedGlobalEvent::Wa
 	UAsyncAction_WaitForTaggedGlobalEvent* NewNode = NewObject<UAsyncAction_WaitForTaggedGlobalEvent>();
 	NewNode->EventRef = Event;
 	NewNode->LocalWorldContext = WorldContextObject;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
@@ -10,32 +10,12 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAsyncFadeCamReached);
 
 UCLASS()
-class OMEGAFLOW_API UAsyncAction_FadeCamera : public UBlueprintAsyncActionBase, public FTickableGameObject
+class OMEGAFLOW_API UAsyncAction_FadeCamera : public UBlueprintAsyncActionBase
 {
 	GENERATED_BODY()
 
 public:
 
-	virtual void Tick(float DeltaTime) override;
-	
-	virtual ETickableTickType GetTickableTickType() const override
-	{
-		return ETickableTickType::Always;
-	}
-	virtual TStatId GetStatId() const override
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT( FMyTickableThing, STATGROUP_Tickables );
-	}
-	virtual bool IsTickableWhenPaused() const
-	{
-		return true;
-	}
-	virtual bool IsTickableInEditor() const
-	{
-		return false;
-	}
-	// FTickableGameObject End
-	
 	UPROPERTY(BlueprintAssignable)
 	FOnAsyncFadeCamReached Finished;
 	
@@ -44,6 +24,8 @@ public:
 	UPROPERTY()
 	bool LocalIsFinishing;
 	UPROPERTY()
+	UObject* local_WorldContext;
+	UPROPERTY()
 	float TargetFadeState;
 	UPROPERTY()
 	FLinearColor TargetFadeColor;
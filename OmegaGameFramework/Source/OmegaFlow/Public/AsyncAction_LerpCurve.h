@@ -10,38 +10,28 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLerpCurveUpdate, float, LerpValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLerpCurveFinished);
 UCLASS()
-class OMEGAFLOW_API UAsyncAction_LerpCurve : public UBlueprintAsyncActionBase, public FTickableGameObject
+class OMEGAFLOW_API UAsyncAction_LerpCurve : public UBlueprintAsyncActionBase
 {
 	GENERATED_BODY()
 
 public:
 
-	virtual void Tick(float DeltaTime) override;
-	virtual ETickableTickType GetTickableTickType() const override {return ETickableTickType::Always; }
-	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( FMyTickableThing, STATGROUP_Tickables ); }
-	virtual bool IsTickableWhenPaused() const { return true; }
-	virtual bool IsTickableInEditor() const { return false; }
-	// FTickableGameObject End
-
 	UPROPERTY(BlueprintAssignable)
 	FOnLerpCurveUpdate Updated;
 	UPROPERTY(BlueprintAssignable)
 	FOnLerpCurveFinished Finished;
 
-	UPROPERTY() bool local_playing;
+	UPROPERTY() UObject* local_WorldContext;
 	UPROPERTY() UCurveFloat* local_curve;
 	UPROPERTY() float local_PlayRate;
 	UPROPERTY() bool local_reversed;
-	UPROPERTY() float elapsed_time;
-	UPROPERTY() float new_value;
-	UPROPERTY() float time_min;
-	UPROPERTY() float time_max;
+	UPROPERTY() FName local_PauseGroup;
 	
 	virtual void Activate() override;
 	
-	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject", AdvancedDisplay="Player"), Category="Omega|AsyncGameplayTasks",
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject", AdvancedDisplay="PauseGroup"), Category="Omega|AsyncGameplayTasks",
 		DisplayName="Ω🔷 Lerp Along Curve")
-	static UAsyncAction_LerpCurve* LerpAlongCurve(UObject* WorldContextObject, UCurveFloat* Curve, float PlayRate=1.0, bool bReverse=false);
+	static UAsyncAction_LerpCurve* LerpAlongCurve(UObject* WorldContextObject, UCurveFloat* Curve, float PlayRate=1.0, bool bReverse=false, FName PauseGroup=NAME_None);
 
 	
 };
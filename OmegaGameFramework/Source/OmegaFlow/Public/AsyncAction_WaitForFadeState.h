@@ -10,32 +10,12 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAsyncFadeStateReached);
 
 UCLASS()
-class OMEGAFLOW_API UAsyncAction_WaitForFadeState : public UBlueprintAsyncActionBase, public FTickableGameObject
+class OMEGAFLOW_API UAsyncAction_WaitForFadeState : public UBlueprintAsyncActionBase
 {
 	GENERATED_BODY()
 
 public:
 
-	virtual void Tick(float DeltaTime) override;
-	
-	virtual ETickableTickType GetTickableTickType() const override
-	{
-		return ETickableTickType::Always;
-	}
-	virtual TStatId GetStatId() const override
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT( FMyTickableThing, STATGROUP_Tickables );
-	}
-	virtual bool IsTickableWhenPaused() const
-	{
-		return true;
-	}
-	virtual bool IsTickableInEditor() const
-	{
-		return false;
-	}
-	// FTickableGameObject End
-	
 	UPROPERTY(BlueprintAssignable)
 	FOnAsyncFadeStateReached Finished;
 	
@@ -44,7 +24,11 @@ public:
 	UPROPERTY()
 	bool LocalIsFinishing;
 	UPROPERTY()
+	UObject* local_WorldContext;
+	UPROPERTY()
 	float TargetFadeState;
+
+	virtual void Activate() override;
 	
 	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject", AdvancedDisplay="Player"), Category="Omega|AsyncGameplayTasks",DisplayName="Ω🔷 Wait Camera Fade State")
 	static UAsyncAction_WaitForFadeState* WaitForFadeState(UObject* WorldContextObject, APlayerController* Player, float FadeState);
@@ -26,8 +26,8 @@ public:
 	UPROPERTY()
 	bool Local_State;
 
-	UFUNCTION()
-	void Native_OnFlagEvent(FString Flag, bool State);
+	void Native_OnFlagChanged(bool State);
+	FDelegateHandle FlagListenerHandle;
 
 	UFUNCTION()
 	void Local_Finish();
@@ -27,8 +27,8 @@ public:
 	UPROPERTY()
 	UObject* ContextRef;
 
-	UFUNCTION()
-	void Native_OnEvent(FName Event, UObject* Context);
+	void Native_OnEvent(UObject* Context);
+	FDelegateHandle EventListenerHandle;
 	
 	virtual void Activate() override;
 	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true"), Category="Omega|AsyncGameplayTasks", meta = (WorldContext = "WorldContextObject"),DisplayName="Ω🔷 Wait for Global Event (Named)") 
@@ -55,8 +55,8 @@ public:
 	UPROPERTY()
 	UObject* ContextRef;
 
-	UFUNCTION()
-	void Native_OnEvent(FGameplayTag Event, UObject* Context);
+	void Native_OnEvent(UObject* Context);
+	FDelegateHandle EventListenerHandle;
 	
 	virtual void Activate() override;
 	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true"), Category="Omega|GameplayTasks", meta = (WorldContext = "WorldContextObject"),DisplayName="Ω🔷 Wait for Global Event (Tagged)") 
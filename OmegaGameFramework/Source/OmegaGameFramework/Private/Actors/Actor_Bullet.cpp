@@ -7,6 +7,7 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Components/Component_Combatant.h"
 #include "Kismet/GameplayStatics.h"
+#include "Subsystems/OmegaSubsystem_Projectile.h"
 
 AOmegaBulletActor::AOmegaBulletActor()
 {
@@ -27,12 +28,24 @@ AOmegaBulletActor::AOmegaBulletActor()
 	ProjectileComponent->ProjectileGravityScale=0;
 
 	SphereComponent->OnComponentBeginOverlap.AddDynamic(this, &AOmegaBulletActor::OnSphereOverlap);
+	ProjectileComponent->OnProjectileStop.AddDynamic(this, &AOmegaBulletActor::local_onProjectileStop);
 }
 
 void AOmegaBulletActor::BeginPlay()
 {
 	local_spawnCue(CueOnSpawn);
 	Super::BeginPlay();
+	OnBulletActivated();
+}
+
+void AOmegaBulletActor::LifeSpanExpired()
+{
+	if(bUsePool)
+	{
+		local_releaseOrDestroy();
+		return;
+	}
+	Super::LifeSpanExpired();
 }
 
 
@@ -43,7 +56,7 @@ void AOmegaBulletActor::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent
 
 void AOmegaBulletActor::TriggerImpact(AActor* ImpactedActor)
 {
-	if(ImpactedActor)
+	if(ImpactedActor && bBulletActive)
 	{
 		//try get combatant
 		UCombatantComponent* comb_target = local_getCombatant(ImpactedActor);
@@ -51,11 +64,56 @@ void AOmegaBulletActor::TriggerImpact(AActor* ImpactedActor)
 		OnImpact(ImpactedActor,comb_target);
 		local_spawnCue(CueOnImpact);
 		UOmegaScriptedEffectFunctions::ApplyCustomScriptedEffectToCombatant(ImpactEffects,comb_target,InstigatorCombatant);
-		
+
+		local_releaseOrDestroy();
+	}
+}
+
+void AOmegaBulletActor::local_onProjectileStop(const FHitResult& ImpactResult)
+{
+	// A stopped pooled bullet missed, so it goes back to the pool.
+	if(bUsePool && bBulletActive)
+	{
+		local_releaseOrDestroy();
+	}
+}
+
+void AOmegaBulletActor::local_releaseOrDestroy()
+{
+	UOmegaProjectileSubsystem* ProjectileSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UOmegaProjectileSubsystem>() : nullptr;
+	if(bUsePool && ProjectileSubsystem)
+	{
+		ProjectileSubsystem->Native_ReleaseBullet(this);
+	}
+	else
+	{
 		Destroy();
 	}
 }
 
+void AOmegaBulletActor::Native_SetPooledActive(bool bActive)
+{
+	bBulletActive = bActive;
+	SetActorHiddenInGame(!bActive);
+	SetActorEnableCollision(bActive);
+	if(bActive)
+	{
+		ProjectileComponent->SetUpdatedComponent(RootComponent);
+		ProjectileComponent->Velocity = GetActorForwardVector() * ProjectileComponent->InitialSpeed;
+		ProjectileComponent->Activate(true);
+		// Restart the life span of the reused bullet
+		SetLifeSpan(InitialLifeSpan);
+		local_spawnCue(CueOnSpawn);
+		OnBulletActivated();
+	}
+	else
+	{
+		SetLifeSpan(0.0);
+		ProjectileComponent->StopMovementImmediately();
+		ProjectileComponent->Deactivate();
+	}
+}
+
 void AOmegaBulletActor::local_spawnCue(TSubclassOf<AOmegaGameplayCue> cue)
 {
 	if(cue)
@@ -78,6 +136,21 @@ void UOmegaBulletFunctions::SpawnBullet(UObject* WorldContextObject, TSubclassOf
 {
 	if(Bullet)
 	{
+		const AOmegaBulletActor* DefaultBullet = GetDefault<AOmegaBulletActor>(Bullet);
+		if(UOmegaProjectileSubsystem* ProjectileSubsystem = WorldContextObject->GetWorld()->GetSubsystem<UOmegaProjectileSubsystem>())
+		{
+			if(DefaultBullet->bRunAsData)
+			{
+				ProjectileSubsystem->Native_SpawnDataBullet(Bullet, Origin, Effects, Instigator);
+				return;
+			}
+			if(DefaultBullet->bUsePool)
+			{
+				ProjectileSubsystem->Native_AcquireBullet(Bullet, Origin, Effects, Instigator);
+				return;
+			}
+		}
+		
 		AOmegaBulletActor* CueRef = WorldContextObject->GetWorld()->SpawnActorDeferred<AOmegaBulletActor>(Bullet, Origin, nullptr);
 		CueRef->InstigatorCombatant=Instigator;
 		CueRef->ImpactEffects=Effects;
@@ -9,6 +9,9 @@
 #include "Components/Component_Combatant.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetTextLibrary.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
 
 
 // Sets default values
@@ -24,6 +27,10 @@ void AOmegaGameplayEffect::BeginPlay()
 {
 	Super::BeginPlay();
 
+	//Only tick if the lifetime update is actually used
+	SetActorTickEnabled(GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, LifetimeUpdated))
+		|| GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, ReceiveTick)));
+
 	//Construct DamageFormula Object
 	//LocalFormula = NewObject<UDamageFormula>(this, DamageFormula, FName("LocalFormula"));
 
@@ -212,6 +219,63 @@ void AOmegaGameplayEffect::TriggerEffect()
 	
 }
 
+bool AOmegaGameplayEffect::CanRunAsData(TSubclassOf<AOmegaGameplayEffect> EffectClass)
+{
+	if(!EffectClass)
+	{
+		return false;
+	}
+	const AOmegaGameplayEffect* DefaultEffect = GetDefault<AOmegaGameplayEffect>(EffectClass);
+	if(!DefaultEffect->bRunAsData || DefaultEffect->bUseVolume || DefaultEffect->bShowPopupOnTrigger)
+	{
+		return false;
+	}
+
+	//Blueprint events need an actor instance to run on
+	static const FName ActorEvents[] = {
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, EffectApplied),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, EffectBeginPlay),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, LifetimeUpdated),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, OnAttributeDamaged),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, GetImpactHitResult),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, GetObjectGameplayTags),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, GetObjectGameplayCategory),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, GetDamageType),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, ReceiveBeginPlay),
+		GET_FUNCTION_NAME_CHECKED(AOmegaGameplayEffect, ReceiveTick),
+	};
+	for(const FName& TempEvent : ActorEvents)
+	{
+		if(EffectClass->IsFunctionImplementedInScript(TempEvent))
+		{
+			return false;
+		}
+	}
+
+	//A Blueprint formula may read its outer effect, which would be the class default in the data path
+	if(DefaultEffect->LocalFormula && DefaultEffect->LocalFormula->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UDamageFormula, GetDamageAmount)))
+	{
+		return false;
+	}
+
+	//Components added in a blueprint are visuals. The default scene root does not count.
+	for(const UClass* TempClass = EffectClass; TempClass; TempClass = TempClass->GetSuperClass())
+	{
+		const UBlueprintGeneratedClass* BlueprintClass = Cast<UBlueprintGeneratedClass>(TempClass);
+		if(BlueprintClass && BlueprintClass->SimpleConstructionScript)
+		{
+			for(const USCS_Node* TempNode : BlueprintClass->SimpleConstructionScript->GetAllNodes())
+			{
+				if(TempNode && TempNode->ComponentTemplate && TempNode->ComponentTemplate->GetClass() != USceneComponent::StaticClass())
+				{
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
 UOmegaDamageType* AOmegaGameplayEffect::GetDamageType_Implementation(UObject* Context)
 {
 	return nullptr;
@@ -229,6 +293,7 @@ void AOmegaGameplayEffect::Local_RemoveEffects(FGameplayTagContainer Effects)
 				TempEffect->Destroy();
 			}
 		};
+		TargetedCombatant->RemoveDataEffectsWithTags(Effects);
 	}
 }
 
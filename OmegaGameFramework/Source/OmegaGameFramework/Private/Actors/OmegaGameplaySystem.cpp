@@ -38,7 +38,7 @@ void AOmegaGameplaySystem::BeginPlay()
 	GetGameInstance()->GetSubsystem<UOmegaGameManager>()->OnGlobalEvent.AddDynamic(this, &AOmegaGameplaySystem::OnGlobalEvent);
 	GetGameInstance()->GetSubsystem<UOmegaGameManager>()->OnTaggedGlobalEvent.AddDynamic(this, &AOmegaGameplaySystem::OnTaggedGlobalEvent);
 	GetGameInstance()->GetSubsystem<UOmegaSaveSubsystem>()->OnNewGameStarted.AddDynamic(this, &AOmegaGameplaySystem::OnNewGameStarted);
-	GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>()->SetQueuedDelaySourceRegistered(this,true);
+	GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>()->SetQueuedDelaySourceRegistered(this,true,bPushQueuedDelay);
 	OMACRO_INSTALL_QUEUEDQUERY()
 
 	
@@ -96,6 +96,16 @@ void AOmegaGameplaySystem::BeginPlay()
 	Super::BeginPlay();
 }
 
+void AOmegaGameplaySystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Systems removed by level travel or Destroy never reach CompleteShutdown, so release their queued delay here.
+	if(UGameInstance* LocalInstance = GetGameInstance())
+	{
+		LocalInstance->GetSubsystem<UOmegaSubsystem_QueueDelay>()->SetQueuedDelaySourceRegistered(this,false);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 void AOmegaGameplaySystem::Destroyed()
 {
 	Super::Destroyed();
@@ -126,6 +136,11 @@ void AOmegaGameplaySystem::SystemShutdown_Implementation(UObject* Context, const
 	
 }
 
+void AOmegaGameplaySystem::RefreshQueuedDelay()
+{
+	GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>()->UpdateQueuedDelaySource(this);
+}
+
 void AOmegaGameplaySystem::Shutdown(UObject* Context, FString Flag)
 {
 	// Block if already shutting down;
@@ -143,6 +158,7 @@ void AOmegaGameplaySystem::Shutdown(UObject* Context, FString Flag)
 	Shutdown_Flag = Flag;
 	
 	bIsInShutdown = true;
+	RefreshQueuedDelay();
 	OnBeginShutdown(Shutdown_Context, Shutdown_Flag);
 	
 }
@@ -161,6 +177,7 @@ void AOmegaGameplaySystem::CompleteShutdown()
 
 		GetGameInstance()->GetSubsystem<UOmegaSaveSubsystem>()->SetSaveSourceRegistered(this,false);
 		GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueuedQuery>()->SetQueuedQuerySourceRegistered(this,false);
+		GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>()->SetQueuedDelaySourceRegistered(this,false);
 		// Remove Player Widgets
 		for (class UHUDLayer* TempWidget : ActivePlayerWidgets)
 		{
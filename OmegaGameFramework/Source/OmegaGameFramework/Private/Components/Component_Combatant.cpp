@@ -3,18 +3,21 @@
 
 #include "Components/Component_Combatant.h"
 
+#include "OmegaGameFramework.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetTextLibrary.h"
+#include "TimerManager.h"
 
 #include "Actors/Actor_Ability.h"
 #include "Actors/Actor_GameplayEffect.h"
 #include "Actors/CombatantTargetIndicator.h"
 
 #include "Subsystems/OmegaSubsystem_Gameplay.h"
+#include "Subsystems/OmegaSubsystem_Effects.h"
 
 #include "Interfaces/OmegaInterface_Widget.h"
 #include "Interfaces/OmegaInterface_Combatant.h"
@@ -30,7 +33,11 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
 
-
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Cache Hits"), STAT_OmegaAttributeCacheHits, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Cache Misses"), STAT_OmegaAttributeCacheMisses, STATGROUP_Omega);
+DECLARE_CYCLE_STAT(TEXT("Combatant Widget Flush"), STAT_OmegaCombatantWidgetFlush, STATGROUP_Omega);
+DECLARE_CYCLE_STAT(TEXT("Damage Batch"), STAT_OmegaDamageBatch, STATGROUP_Omega);
+DECLARE_CYCLE_STAT(TEXT("Modifier Table Rebuild"), STAT_OmegaModifierTableRebuild, STATGROUP_Omega);
 
 
 // Sets default values for this component's properties
@@ -93,6 +100,14 @@ void UCombatantComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		TempActor->K2_DestroyActor();
 	}
+	while(DataEffects.Num() > 0)
+	{
+		local_RemoveDataEffectAt(DataEffects.Num()-1);
+	}
+	if(UOmegaEffectSubsystem* EffectSubsystem = GetWorld()->GetSubsystem<UOmegaEffectSubsystem>())
+	{
+		EffectSubsystem->Native_UnregisterDataEffects(this);
+	}
 	
 	//Destroy abilities
 	Super::EndPlay(EndPlayReason);
@@ -135,6 +150,7 @@ void UCombatantComponent::SetAbilityActive(bool bActive, AOmegaAbility* Ability)
 void UCombatantComponent::ChangeAttributeSet(UOmegaAttributeSet* NewSet, bool Reinitialize)
 {
 	AttributeSet=NewSet;
+	local_ClearCachedAttributeValues();
 	if(Reinitialize)
 	{
 		InitializeAttributes();
@@ -194,55 +210,189 @@ bool UCombatantComponent::CombatantHasAllTag(FGameplayTagContainer Tags, bool Ex
 ///////////////////////////////////
 void UCombatantComponent::Update()
 {
-	TArray<UUserWidget*> FoundWidgets;
-    UWidgetBlueprintLibrary::GetAllWidgetsWithInterface(this, FoundWidgets, UWidgetInterface_Combatant::StaticClass(), false);
-
-    for (auto* TempWidget : FoundWidgets)
-    {
-        if (IWidgetInterface_Combatant::Execute_GetCombatantComponent(TempWidget) == this && AttributeSet)
-        {
-            IWidgetInterface_Combatant::Execute_OnCombatantUpdated(TempWidget, this);
-
-            // Update attribute texts and progress bars
-            for (auto* LocalAtb : AttributeSet->Attributes)
-            {
-                float DumVal = 0.f, DumMax = 0.f;
-                GetAttributeValue(LocalAtb, DumVal, DumMax);
-
-                UTextBlock* ValText = nullptr;
-                UTextBlock* MaxText = nullptr;
-                IWidgetInterface_Combatant::Execute_GetAttributeTexts(TempWidget, LocalAtb, ValText, MaxText);
-
-                if (MaxText)
-                {
-                    MaxText->SetText(UKismetTextLibrary::Conv_FloatToText(
-	                    DumMax, LocalAtb->RoundingMode, LocalAtb->bAlwaysSign, LocalAtb->bUseGrouping,
-	                    LocalAtb->MinIntegralDigits, LocalAtb->MaxIntegralDigits, LocalAtb->MinFractionalDigits,
-	                    LocalAtb->MaxFractionalDigits));
-                }
-
-                if (ValText)
-                {
-                    ValText->SetText(UKismetTextLibrary::Conv_FloatToText(
-	                    DumVal, LocalAtb->RoundingMode, LocalAtb->bAlwaysSign, LocalAtb->bUseGrouping,
-	                    LocalAtb->MinIntegralDigits, LocalAtb->MaxIntegralDigits, LocalAtb->MinFractionalDigits,
-	                    LocalAtb->MaxFractionalDigits));
-                }
-
-                UProgressBar* AttProg = nullptr;
-                bool bLocal_BarToColor = false;
-                IWidgetInterface_Combatant::Execute_GetAttributeProgressBar(TempWidget, LocalAtb, AttProg, bLocal_BarToColor);
-                if (AttProg)
-                {
-                    AttProg->SetPercent(GetAttributePercentage(LocalAtb));
-                    if (bLocal_BarToColor)
-                    {
-                        AttProg->SetFillColorAndOpacity(LocalAtb->AttributeColor);
-                    }
-                }
-            }
-        }
-    }
+	if(bWidgetUpdatePending || !GetWorld())
+	{
+		return;
+	}
+	// Many updates in one frame (e.g. an area hit) collapse into a single flush.
+	bWidgetUpdatePending = true;
+	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UCombatantComponent::FlushWidgetUpdates);
+}
+
+void UCombatantComponent::FlushWidgetUpdates()
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaCombatantWidgetFlush);
+	bWidgetUpdatePending = false;
+
+	if(bScanForCombatantWidgets)
+	{
+		TArray<UUserWidget*> FoundWidgets;
+		UWidgetBlueprintLibrary::GetAllWidgetsWithInterface(this, FoundWidgets, UWidgetInterface_Combatant::StaticClass(), false);
+		for(auto* TempWidget : FoundWidgets)
+		{
+			// Added directly, since this flush already pushes to them.
+			if(!REF_CombatantWidgets.Contains(TempWidget) && IWidgetInterface_Combatant::Execute_GetCombatantComponent(TempWidget) == this)
+			{
+				REF_CombatantWidgets.Add(TempWidget);
+				REF_NewCombatantWidgets.Add(TempWidget);
+			}
+		}
+	}
+	
+	// Widgets that now show another combatant stop receiving updates.
+	REF_CombatantWidgets.RemoveAll([this](const TWeakObjectPtr<UUserWidget>& TempWidget)
+	{
+		return !TempWidget.IsValid() || IWidgetInterface_Combatant::Execute_GetCombatantComponent(TempWidget.Get()) != this;
+	});
+	if(REF_CombatantWidgets.IsEmpty())
+	{
+		REF_NewCombatantWidgets.Empty();
+		return;
+	}
+
+	// Find the attributes whose value changed since the last flush.
+	TArray<UOmegaAttribute*> ChangedAttributes;
+	TArray<FVector2D> AttributeValues;
+	if(AttributeSet)
+	{
+		for(auto* LocalAtb : AttributeSet->Attributes)
+		{
+			if(!LocalAtb)
+			{
+				continue;
+			}
+			float DumVal = 0.f, DumMax = 0.f;
+			GetAttributeValue(LocalAtb, DumVal, DumMax);
+			const FVector2D NewValue(DumVal, DumMax);
+			FVector2D& PushedValue = REF_PushedAttributeValues.FindOrAdd(LocalAtb, FVector2D(-1.f, -1.f));
+			AttributeValues.Add(NewValue);
+			if(PushedValue != NewValue)
+			{
+				PushedValue = NewValue;
+				ChangedAttributes.Add(LocalAtb);
+			}
+		}
+	}
+	
+	// Widgets may register or unregister from OnCombatantUpdated, so work on copies.
+	const TArray<TWeakObjectPtr<UUserWidget>> LocalWidgets = REF_CombatantWidgets;
+	const TArray<TWeakObjectPtr<UUserWidget>> LocalNewWidgets = REF_NewCombatantWidgets;
+	for(const TWeakObjectPtr<UUserWidget>& WeakWidget : LocalWidgets)
+	{
+		UUserWidget* TempWidget = WeakWidget.Get();
+		if(!TempWidget)
+		{
+			continue;
+		}
+		IWidgetInterface_Combatant::Execute_OnCombatantUpdated(TempWidget, this);
+		if(!AttributeSet)
+		{
+			continue;
+		}
+
+		if(LocalNewWidgets.Contains(WeakWidget))
+		{
+			int32 ValueIndex = 0;
+			for(auto* LocalAtb : AttributeSet->Attributes)
+			{
+				if(LocalAtb)
+				{
+					const FVector2D& TempValue = AttributeValues[ValueIndex++];
+					local_PushAttributeToWidget(TempWidget, LocalAtb, TempValue.X, TempValue.Y);
+				}
+			}
+		}
+		else
+		{
+			for(auto* LocalAtb : ChangedAttributes)
+			{
+				const FVector2D& TempValue = REF_PushedAttributeValues[LocalAtb];
+				local_PushAttributeToWidget(TempWidget, LocalAtb, TempValue.X, TempValue.Y);
+			}
+		}
+	}
+	// Widgets scanned by a nested flush during the loop keep their full push for the next one.
+	REF_NewCombatantWidgets.RemoveAll([&LocalNewWidgets](const TWeakObjectPtr<UUserWidget>& TempWidget){ return LocalNewWidgets.Contains(TempWidget); });
+}
+
+void UCombatantComponent::RegisterCombatantWidget(UUserWidget* Widget)
+{
+	if(!Widget || !Widget->GetClass()->ImplementsInterface(UWidgetInterface_Combatant::StaticClass()) || REF_CombatantWidgets.Contains(Widget))
+	{
+		return;
+	}
+	REF_CombatantWidgets.Add(Widget);
+	local_RefreshCombatantWidget(Widget);
+}
+
+void UCombatantComponent::BindCombatantWidget(UUserWidget* Widget)
+{
+	if(Widget && Widget->GetClass()->ImplementsInterface(UWidgetInterface_Combatant::StaticClass()))
+	{
+		if(UCombatantComponent* TempCombatant = IWidgetInterface_Combatant::Execute_GetCombatantComponent(Widget))
+		{
+			TempCombatant->RegisterCombatantWidget(Widget);
+		}
+	}
+}
+
+void UCombatantComponent::UnregisterCombatantWidget(UUserWidget* Widget)
+{
+	REF_CombatantWidgets.Remove(Widget);
+	REF_NewCombatantWidgets.Remove(Widget);
+}
+
+void UCombatantComponent::local_RefreshCombatantWidget(UUserWidget* Widget)
+{
+	IWidgetInterface_Combatant::Execute_OnCombatantUpdated(Widget, this);
+	if(AttributeSet)
+	{
+		for(auto* LocalAtb : AttributeSet->Attributes)
+		{
+			if(LocalAtb)
+			{
+				float DumVal = 0.f, DumMax = 0.f;
+				GetAttributeValue(LocalAtb, DumVal, DumMax);
+				local_PushAttributeToWidget(Widget, LocalAtb, DumVal, DumMax);
+			}
+		}
+	}
+}
+
+void UCombatantComponent::local_PushAttributeToWidget(UUserWidget* Widget, UOmegaAttribute* Attribute, float Value, float MaxValue)
+{
+	// Update attribute texts and progress bars
+	UTextBlock* ValText = nullptr;
+	UTextBlock* MaxText = nullptr;
+	IWidgetInterface_Combatant::Execute_GetAttributeTexts(Widget, Attribute, ValText, MaxText);
+
+	if (MaxText)
+	{
+		MaxText->SetText(UKismetTextLibrary::Conv_FloatToText(
+			MaxValue, Attribute->RoundingMode, Attribute->bAlwaysSign, Attribute->bUseGrouping,
+			Attribute->MinIntegralDigits, Attribute->MaxIntegralDigits, Attribute->MinFractionalDigits,
+			Attribute->MaxFractionalDigits));
+	}
+
+	if (ValText)
+	{
+		ValText->SetText(UKismetTextLibrary::Conv_FloatToText(
+			Value, Attribute->RoundingMode, Attribute->bAlwaysSign, Attribute->bUseGrouping,
+			Attribute->MinIntegralDigits, Attribute->MaxIntegralDigits, Attribute->MinFractionalDigits,
+			Attribute->MaxFractionalDigits));
+	}
+
+	UProgressBar* AttProg = nullptr;
+	bool bLocal_BarToColor = false;
+	IWidgetInterface_Combatant::Execute_GetAttributeProgressBar(Widget, Attribute, AttProg, bLocal_BarToColor);
+	if (AttProg)
+	{
+		AttProg->SetPercent(MaxValue != 0.f ? Value / MaxValue : 0.f);
+		if (bLocal_BarToColor)
+		{
+			AttProg->SetFillColorAndOpacity(Attribute->AttributeColor);
+		}
+	}
 }
 
 APawn* UCombatantComponent::GetOwnerPawn()
@@ -535,56 +685,110 @@ float UCombatantComponent::ApplyAttributeDamage(class UOmegaAttribute* Attribute
 	{
 		return 0;
 	}
-	float CurrentValue;
-	float MaxVal;
 
-	// INIT Contextual Values
-	UOmegaDamageType* LocalDamageType = nullptr;
-	if(DamageType)
-	{
-		LocalDamageType = DamageType;
-	}
-	
-	UObject* LocalContext = nullptr;
-	if(Context)
+	UOmegaDamageTypeReactionAsset* ReactClass = nullptr;
+	const float FinalDamage = local_ResolveDamage(Attribute, BaseDamage, Instigator, Context, DamageType, GetDamageModifiers(), ReactClass);
+	if(ReactionEffectClass && ReactClass)
 	{
-		LocalContext = Context;
+		CreateEffect(ReactionEffectClass,1.0,this,FGameplayTagContainer(),ReactClass);
 	}
 	
-	GetAttributeValue(Attribute, CurrentValue, MaxVal);		//Set correct attribute values
+	//--------------------- FINISH AND APPLY ---------------------///
+	local_DeductAttributeValue(Attribute, FinalDamage);
+	OnDamaged.Broadcast(this, Attribute, FinalDamage, Instigator, DamageType, Hit);
+	Update();
+	return FinalDamage;
+}
+
+float UCombatantComponent::local_ResolveDamage(UOmegaAttribute* Attribute, float BaseDamage, UCombatantComponent* Instigator, UObject* Context, UOmegaDamageType* DamageType, const TArray<UObject*>& DamageModifiers, UOmegaDamageTypeReactionAsset*& OutReaction)
+{
 	float FinalDamage = BaseDamage;
 
 	//Aply Damage Modifiers
-	for(auto* TempMod : GetDamageModifiers())
+	for(auto* TempMod : DamageModifiers)
 	{
-		FinalDamage = IDataInterface_DamageModifier::Execute_ModifyDamage(TempMod, Attribute, this, Instigator, BaseDamage, LocalDamageType, Context); //Apply Damage Modifier
+		FinalDamage = IDataInterface_DamageModifier::Execute_ModifyDamage(TempMod, Attribute, this, Instigator, BaseDamage, DamageType, Context); //Apply Damage Modifier
 	}
 	
 	// DAMAGE TYPE REACTIONS
-	if(DamageType && DamageTypeReactions.Contains(DamageType))
+	OutReaction = nullptr;
+	if(DamageType)
 	{
-		UOmegaDamageTypeReactionAsset* ReactClass = DamageTypeReactions.FindOrAdd(DamageType);
-		if(GetDamageReactionObject(ReactClass))
+		if(UOmegaDamageTypeReactionAsset** FoundReaction = DamageTypeReactions.Find(DamageType))
 		{
-			UE_LOG(LogTemp, Display, TEXT("Apply reaction damage for %s"), *ReactClass->GetName());
-			FinalDamage = GetDamageReactionObject(ReactClass)->OnDamageApplied(Attribute, FinalDamage);
-		}
-		if(ReactionEffectClass && ReactClass)
-		{
-			CreateEffect(ReactionEffectClass,1.0,this,FGameplayTagContainer(),ReactClass);
+			OutReaction = *FoundReaction;
+			if(UOmegaDamageTypeReaction* ReactionObject = GetDamageReactionObject(OutReaction))
+			{
+				FinalDamage = ReactionObject->OnDamageApplied(Attribute, FinalDamage);
+			}
 		}
 	}
-	
-	//--------------------- FINISH AND APPLY ---------------------///
-	
+	return FinalDamage;
+}
+
+void UCombatantComponent::local_DeductAttributeValue(UOmegaAttribute* Attribute, float FinalDamage)
+{
+	float CurrentValue;
+	float MaxVal;
+	GetAttributeValue(Attribute, CurrentValue, MaxVal);		//Set correct attribute values
 	CurrentValue = CurrentValue - FinalDamage;		//Deduct final damage value from current attribute value
 	CurrentValue = FMath::Clamp(CurrentValue, 0.0f, MaxVal);		//Make sure the value does not go under 0 or exceed the max allowed value
-
-	//FINALIZE
 	CurrentAttributeValues.Add(Attribute, CurrentValue);
-	OnDamaged.Broadcast(this, Attribute, FinalDamage, Instigator, LocalDamageType, Hit);
-	Update();
-	return FinalDamage;
+}
+
+TArray<float> UCombatantComponent::Native_ApplyAttributeDamageBatch(const TArray<FOmegaDamageRecord>& Records, UCombatantComponent* Instigator, UObject* Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaDamageBatch);
+	TArray<float> FinalDamages;
+	FinalDamages.SetNumZeroed(Records.Num());
+
+	// Group the records by target so each target's modifiers are gathered once.
+	TMap<UCombatantComponent*, TArray<int32>> RecordsByTarget;
+	for(int32 i = 0; i < Records.Num(); ++i)
+	{
+		UCombatantComponent* Target = Records[i].Target;
+		if(Target && Records[i].Attribute && Target->bCanDamageAttributes)
+		{
+			RecordsByTarget.FindOrAdd(Target).Add(i);
+		}
+	}
+
+	// Resolve and apply every value before any delegate runs, so listeners see the final state of the hit.
+	TMap<UCombatantComponent*, TArray<UOmegaDamageTypeReactionAsset*>> ReactionsByTarget;
+	for(const TPair<UCombatantComponent*, TArray<int32>>& Pair : RecordsByTarget)
+	{
+		UCombatantComponent* Target = Pair.Key;
+		const TArray<UObject*> DamageModifiers = Target->GetDamageModifiers();
+		for(const int32 RecordIndex : Pair.Value)
+		{
+			const FOmegaDamageRecord& TempRecord = Records[RecordIndex];
+			UOmegaDamageTypeReactionAsset* ReactClass = nullptr;
+			FinalDamages[RecordIndex] = Target->local_ResolveDamage(TempRecord.Attribute, TempRecord.BaseDamage, Instigator, Context, TempRecord.DamageType, DamageModifiers, ReactClass);
+			Target->local_DeductAttributeValue(TempRecord.Attribute, FinalDamages[RecordIndex]);
+			if(ReactClass && Target->ReactionEffectClass)
+			{
+				ReactionsByTarget.FindOrAdd(Target).AddUnique(ReactClass);
+			}
+		}
+	}
+
+	for(const TPair<UCombatantComponent*, TArray<UOmegaDamageTypeReactionAsset*>>& Pair : ReactionsByTarget)
+	{
+		for(auto* ReactClass : Pair.Value)
+		{
+			Pair.Key->CreateEffect(Pair.Key->ReactionEffectClass,1.0,Pair.Key,FGameplayTagContainer(),ReactClass);
+		}
+	}
+	for(const TPair<UCombatantComponent*, TArray<int32>>& Pair : RecordsByTarget)
+	{
+		for(const int32 RecordIndex : Pair.Value)
+		{
+			const FOmegaDamageRecord& TempRecord = Records[RecordIndex];
+			Pair.Key->OnDamaged.Broadcast(Pair.Key, TempRecord.Attribute, FinalDamages[RecordIndex], Instigator, TempRecord.DamageType, TempRecord.Hit);
+		}
+		Pair.Key->Update();
+	}
+	return FinalDamages;
 }
 
 void UCombatantComponent::CancelAbilitiesWithTags(FGameplayTagContainer Tags)
@@ -607,12 +811,24 @@ void UCombatantComponent::CancelAllAbilities()
 void UCombatantComponent::SetAttributeValueCategory(FGameplayTag CategoryTag, bool bReinitialize)
 {
 	AttributeValueCategory = CategoryTag;
+	local_ClearCachedAttributeValues();
 	if(bReinitialize)
 	{
 		InitializeAttributes();
 	}
 }
 
+void UCombatantComponent::SetLevel(int32 NewLevel)
+{
+	SetCombatantLevel(NewLevel, false);
+}
+
+void UCombatantComponent::SetAttributeLevels(TMap<UOmegaAttribute*, int32> NewLevels)
+{
+	AttributeLevels = NewLevels;
+	local_ClearCachedAttributeValues();
+}
+
 int32 UCombatantComponent::GetAttributeLevel(UOmegaAttribute* Attribute)
 {
 	if(!Attribute)
@@ -644,11 +860,13 @@ TArray<UPrimaryDataAsset*> UCombatantComponent::GetAllSkills()
 void UCombatantComponent::AddSkill(UPrimaryDataAsset* Skill)
 {
 	Skills.Add(Skill);
+	InvalidateAttributeCache();
 }
 
 void UCombatantComponent::RemoveSkill(UPrimaryDataAsset* Skill)
 {
 	Skills.Remove(Skill);
+	InvalidateAttributeCache();
 }
 
 bool UCombatantComponent::SetSkillSourceActive(UObject* SkillSource, bool bActive)
@@ -667,6 +885,7 @@ bool UCombatantComponent::SetSkillSourceActive(UObject* SkillSource, bool bActiv
 		{
 			Local_SkillSources.Remove(SkillSource);
 		}
+		InvalidateAttributeCache();
 	}
 	return true;
 }
@@ -718,16 +937,28 @@ void UCombatantComponent::GetAttributeValue(UOmegaAttribute* Attribute, float& C
 	{
 		MaxValue = OverrideMaxAttributes[Attribute];
 	}
+	else if(const float* CachedValue = bCacheAttributeValues ? CachedMaxAttributeValues.Find(Attribute) : nullptr)
+	{
+		INC_DWORD_STAT(STAT_OmegaAttributeCacheHits);
+		MaxValue = *CachedValue;
+	}
 	else
 	{
+		INC_DWORD_STAT(STAT_OmegaAttributeCacheMisses);
 		//Get base value
 		float BaseValue = GetAttributeBaseValue(Attribute);
 	
-		//Gather All modifiers and apply them to final damage.
-		BaseValue = GatherAttributeModifiers(GetAttributeModifiers(),BaseValue, Attribute);
+		//Apply the flattened modifier table
+		if(Attribute->bAllowModifiers)
+		{
+			BaseValue = GetAttributeModifierTable().Apply(Attribute, BaseValue);
+		}
 	
 		MaxValue  = BaseValue;
-		//Get Current Value
+		if(bCacheAttributeValues)
+		{
+			CachedMaxAttributeValues.Add(Attribute, MaxValue);
+		}
 	}
 	
 	if (Attribute->bIsValueStatic)
@@ -771,12 +1002,14 @@ bool UCombatantComponent::IsAbilityTagBlocked(FGameplayTagContainer Tags)
 void UCombatantComponent::SetOverrideMaxAttribute(UOmegaAttribute* Attribute, float Value)
 {
 	OverrideMaxAttributes.Add(Attribute,Value);
+	local_ClearCachedAttributeValues();
 	Update();
 }
 
 void UCombatantComponent::SetOverrideMaxAttributes(TMap<UOmegaAttribute*, float> Value)
 {
 	OverrideMaxAttributes=Value;
+	local_ClearCachedAttributeValues();
 	Update();
 }
 
@@ -828,6 +1061,7 @@ void UCombatantComponent::SetCurrentAttributeValues(TMap<UOmegaAttribute*, float
 void UCombatantComponent::SetCombatantLevel(int32 NewLevel, bool ReinitializeStats)
 {
 	Level = NewLevel;
+	local_ClearCachedAttributeValues();
 	OnLevelChanged.Broadcast(NewLevel);
 	if(ReinitializeStats)
 	{
@@ -888,11 +1122,42 @@ void UCombatantComponent::SetAttributeModifierActive(UObject* Modifier, bool bAc
 	
 }
 
+void UCombatantComponent::InvalidateAttributeCache()
+{
+	local_ClearCachedAttributeValues();
+	bModifierTableDirty = true;
+}
+
+const FOmegaAttributeModifierTable& UCombatantComponent::GetAttributeModifierTable()
+{
+	// Without the value cache, modifier sources may change their values at any time. Rebuild at most once a frame.
+	if(!bModifierTableDirty && !bCacheAttributeValues && ModifierTableFrame != GFrameCounter)
+	{
+		bModifierTableDirty = true;
+	}
+	if(bModifierTableDirty)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_OmegaModifierTableRebuild);
+		ModifierTable.Reset();
+		for(UObject* TempObject : GetAttributeModifiers())
+		{
+			if(TempObject && TempObject->Implements<UDataInterface_AttributeModifier>())
+			{
+				ModifierTable.AddModifiers(IDataInterface_AttributeModifier::Execute_GetModifierValues(TempObject));
+			}
+		}
+		bModifierTableDirty = false;
+		ModifierTableFrame = GFrameCounter;
+	}
+	return ModifierTable;
+}
+
 bool UCombatantComponent::AddAttrbuteModifier(UObject* Modifier)
 {
-	if(Modifier->Implements<UDataInterface_AttributeModifier>())
+	if(Modifier && Modifier->Implements<UDataInterface_AttributeModifier>())
 	{
 		AttributeModifiers.Add(Modifier);
+		InvalidateAttributeCache();
 		return true;
 	}
 	return false;
@@ -907,6 +1172,7 @@ bool UCombatantComponent::RemoveAttributeModifier(UObject* Modifier)
 	if(AttributeModifiers.Contains(Modifier))
 	{
 		AttributeModifiers.Remove(Modifier);
+		InvalidateAttributeCache();
 		return true;
 	}
 	return false;
@@ -965,27 +1231,17 @@ float UCombatantComponent::GatherAttributeModifiers(TArray<UObject*> Modifiers,
 		return BaseValue;
 	}
 	
-	//Set Init Value
-	float OutValue = BaseValue;
-	TArray<FOmegaAttributeModifier> TempModList;
+	//Flatten the given modifiers, then apply only this attribute's bucket
+	FOmegaAttributeModifierTable LocalTable;
 	for(UObject* TempObject : Modifiers)
 	{
 		// Make suRe this object uses a Attribute Modifier Interface
-		if(TempObject)
+		if(TempObject && TempObject->Implements<UDataInterface_AttributeModifier>())
 		{
-			if(TempObject->Implements<UDataInterface_AttributeModifier>())
-			{
-				//Gather Attributes from Object
-				TArray<FOmegaAttributeModifier> NewMods = IDataInterface_AttributeModifier::Execute_GetModifierValues(TempObject);
-				TempModList.Append(NewMods);
-				
-			}
+			LocalTable.AddModifiers(IDataInterface_AttributeModifier::Execute_GetModifierValues(TempObject));
 		}
 	}
-	OutValue = AdjustAttributeValueByModifiers(Attribute, TempModList);
-
-	
-	return OutValue;
+	return LocalTable.Apply(Attribute, GetAttributeBaseValue(Attribute));
 }
 
 float UCombatantComponent::AdjustAttributeValueByModifiers(UOmegaAttribute* Attribute,
@@ -995,15 +1251,18 @@ float UCombatantComponent::AdjustAttributeValueByModifiers(UOmegaAttribute* Attr
 	{
 		return 0;
 	}
-	float StartVal = GetAttributeBaseValue(Attribute);
-	for(FOmegaAttributeModifier Mod : Modifiers)
+	const float BaseVal = GetAttributeBaseValue(Attribute);
+	float Increment = 0;
+	float Multiplier = 0;
+	for(const FOmegaAttributeModifier& Mod : Modifiers)
 	{
 		if(Mod.Attribute == Attribute)
 		{
-			StartVal = StartVal+Mod.Incrementer+(Mod.Multiplier*GetAttributeBaseValue(Attribute));
+			Increment += Mod.Incrementer;
+			Multiplier += Mod.Multiplier;
 		}
 	}
-	return StartVal;
+	return BaseVal+Increment+(Multiplier*BaseVal);
 }
 
 TArray<FOmegaAttributeModifier> UCombatantComponent::GetAllModifierValues()
@@ -1021,6 +1280,48 @@ TArray<FOmegaAttributeModifier> UCombatantComponent::GetAllModifierValues()
 	return OutModVals;
 }
 
+void FOmegaAttributeModifierTable::Reset()
+{
+	Attributes.Reset();
+	Increments.Reset();
+	Multipliers.Reset();
+	AttributeIndices.Reset();
+}
+
+void FOmegaAttributeModifierTable::AddModifiers(const TArray<FOmegaAttributeModifier>& Modifiers)
+{
+	for(const FOmegaAttributeModifier& Mod : Modifiers)
+	{
+		if(!Mod.Attribute)
+		{
+			continue;
+		}
+		int32 Index;
+		if(const int32* FoundIndex = AttributeIndices.Find(Mod.Attribute))
+		{
+			Index = *FoundIndex;
+		}
+		else
+		{
+			Index = Attributes.Add(Mod.Attribute);
+			Increments.Add(0);
+			Multipliers.Add(0);
+			AttributeIndices.Add(Mod.Attribute, Index);
+		}
+		Increments[Index] += Mod.Incrementer;
+		Multipliers[Index] += Mod.Multiplier;
+	}
+}
+
+float FOmegaAttributeModifierTable::Apply(UOmegaAttribute* Attribute, float BaseValue) const
+{
+	if(const int32* Index = AttributeIndices.Find(Attribute))
+	{
+		return BaseValue+Increments[*Index]+(Multipliers[*Index]*BaseValue);
+	}
+	return BaseValue;
+}
+
 UOmegaDamageTypeReaction* UCombatantComponent::GetDamageReactionObject(UOmegaDamageTypeReactionAsset* Class)
 {
 	if(Class && Class->ReactionScript)
@@ -1085,6 +1386,14 @@ AOmegaGameplayEffect* UCombatantComponent::CreateEffect(TSubclassOf<AOmegaGamepl
 	if (EffectClass && Target &&
 		!Target->GetBlockedEffectTags().HasAny(GetMutableDefault<AOmegaGameplayEffect>(EffectClass)->EffectTags))
 	{
+		//No actor is needed, so the effect is stored as data on the target.
+		if(AOmegaGameplayEffect::CanRunAsData(EffectClass))
+		{
+			Target->local_AddDataEffect(EffectClass, Power, this, AddedTags, Context);
+			Update();
+			return nullptr;
+		}
+		
 		const FTransform SpawnWorldPoint = Target->GetOwner()->GetActorTransform();
 		
 		class AOmegaGameplayEffect* LocalEffect = GetWorld()->SpawnActorDeferred<AOmegaGameplayEffect>(EffectClass, SpawnWorldPoint, nullptr);
@@ -1121,6 +1430,10 @@ void UCombatantComponent::TriggerEffectsWithTags(FGameplayTagContainer Tags)
 		TempEffect->TriggerEffect();
 		UE_LOG(LogTemp, Display, TEXT("Applied Effect"));
 	}
+	for (const FOmegaDataEffect& TempEffect : GetDataEffectsWithTags(Tags))
+	{
+		local_TriggerDataEffect(TempEffect.EffectId, false);
+	}
 	Update();
 }
 
@@ -1130,11 +1443,22 @@ void UCombatantComponent::TriggerEffectsOfCategory(FGameplayTag CategoryTag)
 	{
 		TempEffect->TriggerEffect();
 	}
+	for (const FOmegaDataEffect& TempEffect : GetDataEffectsOfCategory(CategoryTag))
+	{
+		local_TriggerDataEffect(TempEffect.EffectId, false);
+	}
 	Update();
 }
 
 bool UCombatantComponent::HasEffectWithTags(FGameplayTagContainer Tags)
 {
+	for (const FOmegaDataEffect& TempEffect : DataEffects)
+	{
+		if (TempEffect.EffectTags.HasAnyExact(Tags))
+		{
+			return true;
+		}
+	}
 	return GetEffectsWithTags(Tags).IsValidIndex(0);
 }
 
@@ -1219,6 +1543,13 @@ void UCombatantComponent::RemoveEffectsOfCategory(FGameplayTag CategoryTag)
 	{
 		TempEffect->K2_DestroyActor();
 	}
+	for(int32 i = DataEffects.Num()-1; i >= 0; i--)
+	{
+		if(DataEffects[i].EffectCategory == CategoryTag)
+		{
+			local_RemoveDataEffectAt(i);
+		}
+	}
 }
 
 void UCombatantComponent::RemoveEffectsWithTags(FGameplayTagContainer EffectTags)
@@ -1227,6 +1558,187 @@ void UCombatantComponent::RemoveEffectsWithTags(FGameplayTagContainer EffectTags
 	{
 		TempEffect->K2_DestroyActor();
 	}
+	RemoveDataEffectsWithTags(EffectTags);
+}
+
+///////////////////
+/// Data Effects ////
+/////////////////
+
+TArray<FOmegaDataEffect> UCombatantComponent::GetDataEffectsWithTags(FGameplayTagContainer Tags)
+{
+	TArray<FOmegaDataEffect> OutEffects;
+	for(const FOmegaDataEffect& TempEffect : DataEffects)
+	{
+		if(TempEffect.EffectTags.HasAnyExact(Tags))
+		{
+			OutEffects.Add(TempEffect);
+		}
+	}
+	return OutEffects;
+}
+
+TArray<FOmegaDataEffect> UCombatantComponent::GetDataEffectsOfCategory(FGameplayTag CategoryTag)
+{
+	TArray<FOmegaDataEffect> OutEffects;
+	for(const FOmegaDataEffect& TempEffect : DataEffects)
+	{
+		if(TempEffect.EffectCategory == CategoryTag)
+		{
+			OutEffects.Add(TempEffect);
+		}
+	}
+	return OutEffects;
+}
+
+void UCombatantComponent::RemoveDataEffectsWithTags(FGameplayTagContainer EffectTags)
+{
+	for(int32 i = DataEffects.Num()-1; i >= 0; i--)
+	{
+		if(DataEffects[i].EffectTags.HasAnyExact(EffectTags))
+		{
+			local_RemoveDataEffectAt(i);
+		}
+	}
+}
+
+void UCombatantComponent::local_AddDataEffect(TSubclassOf<AOmegaGameplayEffect> EffectClass, float Power, UCombatantComponent* Instigator, const FGameplayTagContainer& AddedTags, UObject* Context)
+{
+	const AOmegaGameplayEffect* DefaultEffect = GetDefault<AOmegaGameplayEffect>(EffectClass);
+
+	// Removed before the new effect is added, so it can never remove itself.
+	RemoveEffectsWithTags(DefaultEffect->RemoveEffectsOnApplied);
+
+	FOmegaDataEffect NewEffect;
+	NewEffect.EffectId = NextDataEffectId++;
+	NewEffect.EffectClass = EffectClass;
+	NewEffect.Instigator = Instigator;
+	NewEffect.Context = Context;
+	NewEffect.Power = Power;
+	NewEffect.EffectCategory = DefaultEffect->EffectCategory;
+	NewEffect.EffectTags = DefaultEffect->EffectTags;
+	NewEffect.EffectTags.AppendTags(AddedTags);
+
+	switch (DefaultEffect->EffectLifetime)
+	{
+	case EEffectLifetime::EffectLifetime_Instant:
+		NewEffect.Lifetime = 0.1f;
+		break;
+	case EEffectLifetime::EffectLifetime_Timer:
+		NewEffect.Lifetime = DefaultEffect->Lifetime;
+		break;
+	default: break;
+	}
+
+	for(FName TempTag : DefaultEffect->ActorsTagsGranted)
+	{
+		GetOwner()->Tags.Add(TempTag);
+	}
+	DataEffects.Add(NewEffect);
+
+	if(NewEffect.Lifetime >= 0)
+	{
+		if(UOmegaEffectSubsystem* EffectSubsystem = GetWorld()->GetSubsystem<UOmegaEffectSubsystem>())
+		{
+			EffectSubsystem->Native_RegisterDataEffects(this);
+		}
+	}
+}
+
+bool UCombatantComponent::Native_AdvanceDataEffects(float DeltaTime)
+{
+	TArray<int32> ExpiredEffects;
+	bool bHasTimedEffects = false;
+	for(FOmegaDataEffect& TempEffect : DataEffects)
+	{
+		if(TempEffect.Lifetime >= 0)
+		{
+			TempEffect.TimeElapsed += DeltaTime;
+			if(TempEffect.TimeElapsed >= TempEffect.Lifetime)
+			{
+				ExpiredEffects.Add(TempEffect.EffectId);
+			}
+			else
+			{
+				bHasTimedEffects = true;
+			}
+		}
+	}
+
+	for(const int32 TempId : ExpiredEffects)
+	{
+		local_TriggerDataEffect(TempId, true);
+	}
+	if(ExpiredEffects.Num() > 0)
+	{
+		Update();
+		// Triggered effects may have added new timed effects.
+		bHasTimedEffects = DataEffects.ContainsByPredicate([](const FOmegaDataEffect& Effect) { return Effect.Lifetime >= 0; });
+	}
+	return bHasTimedEffects;
+}
+
+void UCombatantComponent::local_TriggerDataEffect(int32 EffectId, bool bRemove)
+{
+	const int32 EffectIndex = DataEffects.IndexOfByPredicate([EffectId](const FOmegaDataEffect& Effect) { return Effect.EffectId == EffectId; });
+	if(EffectIndex == INDEX_NONE)
+	{
+		// Already removed by another effect this frame.
+		return;
+	}
+
+	// Copied, since applying damage can add or remove effects on this combatant.
+	const FOmegaDataEffect LocalEffect = DataEffects[EffectIndex];
+	AOmegaGameplayEffect* DefaultEffect = GetMutableDefault<AOmegaGameplayEffect>(LocalEffect.EffectClass);
+	if(bRemove || DefaultEffect->EffectLifetime == EEffectLifetime::EffectLifetime_OnTrigger)
+	{
+		local_RemoveDataEffectAt(EffectIndex);
+	}
+
+	float DamageFinal = 0;
+	if(DefaultEffect->EffectedAttribute)
+	{
+		float DamageVal = 0;
+		if(DefaultEffect->LocalFormula)
+		{
+			DefaultEffect->LocalFormula->GetDamageAmount(LocalEffect.Instigator, this, DamageVal);
+			DamageVal = DamageVal * LocalEffect.Power;
+		}
+		if(DefaultEffect->AttrbuteEffectType == EOmegaEffectType::OET_Heal)
+		{
+			DamageVal = DamageVal*-1;
+		}
+		DamageFinal = ApplyAttributeDamage(DefaultEffect->EffectedAttribute, DamageVal, LocalEffect.Instigator, LocalEffect.Context, DefaultEffect->GetDamageType(LocalEffect.Context), FHitResult());
+	}
+
+	//Remove Effects, other than this one
+	for(auto* TempActor : GetEffectsWithTags(DefaultEffect->RemoveEffectsOnTrigger))
+	{
+		TempActor->K2_DestroyActor();
+	}
+	for(int32 i = DataEffects.Num()-1; i >= 0; i--)
+	{
+		if(DataEffects[i].EffectId != EffectId && DataEffects[i].EffectTags.HasAnyExact(DefaultEffect->RemoveEffectsOnTrigger))
+		{
+			local_RemoveDataEffectAt(i);
+		}
+	}
+	OnDataEffectTriggered.Broadcast(this, LocalEffect.EffectClass, DamageFinal);
+}
+
+void UCombatantComponent::local_RemoveDataEffectAt(int32 Index)
+{
+	if(DataEffects.IsValidIndex(Index))
+	{
+		if(DataEffects[Index].EffectClass)
+		{
+			for(FName TempTag : GetDefault<AOmegaGameplayEffect>(DataEffects[Index].EffectClass)->ActorsTagsGranted)
+			{
+				GetOwner()->Tags.Remove(TempTag);
+			}
+		}
+		DataEffects.RemoveAt(Index, 1, EAllowShrinking::No);
+	}
 }
 
 
@@ -8,6 +8,13 @@
 #include "SkeletalMergingLibrary.h"
 #include "Engine/SkeletalMesh.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/Engine.h"
+#include "OmegaGameFramework.h"
+#include "OmegaSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("Skin Mesh Merge"), STAT_OmegaSkinMerge, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skin Merged Meshes"), STAT_OmegaSkinMergedMeshes, STATGROUP_Omega);
+DECLARE_MEMORY_STAT(TEXT("Skin Merge Cache Size"), STAT_OmegaSkinMergeCacheSize, STATGROUP_Omega);
 
 
 USkinComponent::USkinComponent()
@@ -217,28 +224,331 @@ void USkinModifier_DynamicMaterial::ApplyModifier_Implementation(AOmegaSkin* Ski
 	}
 }
 
+//----------------------------------------------------------------------------------------------------------------
+// Merge Cache
+//----------------------------------------------------------------------------------------------------------------
+
+void UOmegaSkinMergeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+#if WITH_EDITOR
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UOmegaSkinMergeSubsystem::local_OnObjectPropertyChanged);
+#endif
+}
+
+void UOmegaSkinMergeSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+#endif
+	MergedMeshes.Empty();
+	MergedMeshKeys.Empty();
+	PendingMerges.Empty();
+	PendingOrder.Empty();
+	CachedBytes = 0;
+	local_UpdateStats();
+	Super::Deinitialize();
+}
+
+void UOmegaSkinMergeSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UOmegaSkinMergeSubsystem* This = CastChecked<UOmegaSkinMergeSubsystem>(InThis);
+	for(TPair<FOmegaSkinMergeKey, FOmegaSkinMergeEntry>& TempPair : This->MergedMeshes)
+	{
+		Collector.AddReferencedObject(TempPair.Value.Mesh, This);
+	}
+	//Keep queued inputs alive until they are merged
+	for(TPair<FOmegaSkinMergeKey, FOmegaSkinMergeRequest>& TempPair : This->PendingMerges)
+	{
+		Collector.AddReferencedObject(TempPair.Value.Skeleton, This);
+		Collector.AddReferencedObjects(TempPair.Value.Meshes, This);
+	}
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UOmegaSkinMergeSubsystem::Tick(float DeltaTime)
+{
+	const int32 MaxMerges = FMath::Max(GetDefault<UOmegaSettings>()->MaxSkinMergesPerFrame, 1);
+	for(int32 i = 0; i < MaxMerges && !PendingOrder.IsEmpty(); i++)
+	{
+		const FOmegaSkinMergeKey Key = PendingOrder[0];
+		PendingOrder.RemoveAt(0, 1, EAllowShrinking::No);
+
+		FOmegaSkinMergeRequest Request;
+		if(!PendingMerges.RemoveAndCopyValue(Key, Request))
+		{
+			continue;
+		}
+		USkeletalMesh* MergedMesh = nullptr;
+		if(Request.Skeleton)
+		{
+			const TArray<USkeletalMesh*> local_meshes(Request.Meshes);
+			MergedMesh = local_MergeAndCache(Key, Request.Skeleton, local_meshes);
+		}
+		for(TFunction<void(USkeletalMesh*)>& TempCallback : Request.Callbacks)
+		{
+			TempCallback(MergedMesh);
+		}
+	}
+}
+
+FOmegaSkinMergeKey UOmegaSkinMergeSubsystem::local_MakeMergeKey(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
+{
+	FOmegaSkinMergeKey Key;
+	Key.Skeleton = Skeleton;
+	Key.Meshes.Reserve(Meshes.Num());
+	for(USkeletalMesh* TempMesh : Meshes)
+	{
+		Key.Meshes.Add(TempMesh);
+	}
+	return Key;
+}
+
+USkeletalMesh* UOmegaSkinMergeSubsystem::Native_FindMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
+{
+	if(FOmegaSkinMergeEntry* Entry = MergedMeshes.Find(local_MakeMergeKey(Skeleton, Meshes)))
+	{
+		Entry->LastUsedTime = FPlatformTime::Seconds();
+		return Entry->Mesh;
+	}
+	return nullptr;
+}
+
+USkeletalMesh* UOmegaSkinMergeSubsystem::Native_GetMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
+{
+	if(!Skeleton || Meshes.IsEmpty())
+	{
+		return nullptr;
+	}
+	const FOmegaSkinMergeKey Key = local_MakeMergeKey(Skeleton, Meshes);
+	if(FOmegaSkinMergeEntry* Entry = MergedMeshes.Find(Key))
+	{
+		Entry->LastUsedTime = FPlatformTime::Seconds();
+		return Entry->Mesh;
+	}
+	return local_MergeAndCache(Key, Skeleton, Meshes);
+}
+
+void UOmegaSkinMergeSubsystem::Native_RequestMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes, TFunction<void(USkeletalMesh*)>&& Callback)
+{
+	if(!Skeleton || Meshes.IsEmpty())
+	{
+		Callback(nullptr);
+		return;
+	}
+	const FOmegaSkinMergeKey Key = local_MakeMergeKey(Skeleton, Meshes);
+	if(FOmegaSkinMergeEntry* Entry = MergedMeshes.Find(Key))
+	{
+		Entry->LastUsedTime = FPlatformTime::Seconds();
+		Callback(Entry->Mesh);
+		return;
+	}
+	FOmegaSkinMergeRequest* Request = PendingMerges.Find(Key);
+	if(!Request)
+	{
+		Request = &PendingMerges.Add(Key);
+		Request->Skeleton = Skeleton;
+		Request->Meshes.Append(Meshes);
+		PendingOrder.Add(Key);
+	}
+	Request->Callbacks.Add(MoveTemp(Callback));
+}
+
+USkeletalMesh* UOmegaSkinMergeSubsystem::Native_MergeMeshesUncached(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaSkinMerge);
+
+	if(!Skeleton || Meshes.IsEmpty())
+	{
+		return nullptr;
+	}
+	FSkeletalMeshMergeParams MergeParams;
+	MergeParams.Skeleton = Skeleton;
+	for(USkeletalMesh* TempMesh : Meshes)
+	{
+		if(TempMesh)
+		{
+			MergeParams.MeshesToMerge.Add(TempMesh);
+		}
+	}
+	return USkeletalMergingLibrary::MergeMeshes(MergeParams);
+}
+
+USkeletalMesh* UOmegaSkinMergeSubsystem::local_MergeAndCache(const FOmegaSkinMergeKey& Key, USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
+{
+	USkeletalMesh* MergedMesh = Native_MergeMeshesUncached(Skeleton, Meshes);
+	if(!MergedMesh)
+	{
+		return nullptr;
+	}
+
+	FOmegaSkinMergeEntry& Entry = MergedMeshes.Add(Key);
+	Entry.Mesh = MergedMesh;
+	Entry.Bytes = MergedMesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	Entry.LastUsedTime = FPlatformTime::Seconds();
+	MergedMeshKeys.Add(MergedMesh, Key);
+	CachedBytes += Entry.Bytes;
+
+	local_TrimToBudget();
+	local_UpdateStats();
+	return MergedMesh;
+}
+
+void UOmegaSkinMergeSubsystem::AddMergedMeshReference(USkeletalMesh* Mesh)
+{
+	if(const FOmegaSkinMergeKey* Key = MergedMeshKeys.Find(Mesh))
+	{
+		MergedMeshes.FindChecked(*Key).RefCount++;
+	}
+}
+
+void UOmegaSkinMergeSubsystem::ReleaseMergedMesh(USkeletalMesh* Mesh)
+{
+	if(const FOmegaSkinMergeKey* Key = MergedMeshKeys.Find(Mesh))
+	{
+		FOmegaSkinMergeEntry& Entry = MergedMeshes.FindChecked(*Key);
+		Entry.RefCount = FMath::Max(Entry.RefCount - 1, 0);
+		if(Entry.RefCount == 0)
+		{
+			Entry.LastUsedTime = FPlatformTime::Seconds();
+			local_TrimToBudget();
+			local_UpdateStats();
+		}
+	}
+}
+
+void UOmegaSkinMergeSubsystem::ClearUnusedMergedMeshes()
+{
+	TArray<FOmegaSkinMergeKey> UnusedKeys;
+	for(const TPair<FOmegaSkinMergeKey, FOmegaSkinMergeEntry>& TempPair : MergedMeshes)
+	{
+		if(TempPair.Value.RefCount == 0)
+		{
+			UnusedKeys.Add(TempPair.Key);
+		}
+	}
+	for(const FOmegaSkinMergeKey& TempKey : UnusedKeys)
+	{
+		local_RemoveEntry(TempKey);
+	}
+	local_UpdateStats();
+}
+
+void UOmegaSkinMergeSubsystem::local_RemoveEntry(const FOmegaSkinMergeKey& Key)
+{
+	FOmegaSkinMergeEntry Entry;
+	if(MergedMeshes.RemoveAndCopyValue(Key, Entry))
+	{
+		MergedMeshKeys.Remove(Entry.Mesh.Get());
+		CachedBytes -= Entry.Bytes;
+	}
+}
+
+void UOmegaSkinMergeSubsystem::local_TrimToBudget()
+{
+	const int64 BudgetBytes = static_cast<int64>(GetDefault<UOmegaSettings>()->SkinMergeCacheBudgetMB) * 1024 * 1024;
+	while(CachedBytes > BudgetBytes)
+	{
+		//Evict the least recently used mesh that no skin holds
+		const FOmegaSkinMergeKey* OldestKey = nullptr;
+		double OldestTime = TNumericLimits<double>::Max();
+		for(const TPair<FOmegaSkinMergeKey, FOmegaSkinMergeEntry>& TempPair : MergedMeshes)
+		{
+			if(TempPair.Value.RefCount == 0 && TempPair.Value.LastUsedTime < OldestTime)
+			{
+				OldestKey = &TempPair.Key;
+				OldestTime = TempPair.Value.LastUsedTime;
+			}
+		}
+		if(!OldestKey)
+		{
+			return;
+		}
+		local_RemoveEntry(FOmegaSkinMergeKey(*OldestKey));
+	}
+}
+
+void UOmegaSkinMergeSubsystem::local_UpdateStats() const
+{
+	SET_DWORD_STAT(STAT_OmegaSkinMergedMeshes, MergedMeshes.Num());
+	SET_MEMORY_STAT(STAT_OmegaSkinMergeCacheSize, CachedBytes);
+}
+
+#if WITH_EDITOR
+void UOmegaSkinMergeSubsystem::local_OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	USkeletalMesh* ChangedMesh = Cast<USkeletalMesh>(Object);
+	USkeleton* ChangedSkeleton = Cast<USkeleton>(Object);
+	if(!ChangedMesh && !ChangedSkeleton)
+	{
+		return;
+	}
+	//Skins already using a stale merge keep it until they are rebuilt
+	TArray<FOmegaSkinMergeKey> StaleKeys;
+	for(const TPair<FOmegaSkinMergeKey, FOmegaSkinMergeEntry>& TempPair : MergedMeshes)
+	{
+		if((ChangedSkeleton && TempPair.Key.Skeleton == ChangedSkeleton) || (ChangedMesh && TempPair.Key.Meshes.Contains(ChangedMesh)))
+		{
+			StaleKeys.Add(TempPair.Key);
+		}
+	}
+	for(const FOmegaSkinMergeKey& TempKey : StaleKeys)
+	{
+		local_RemoveEntry(TempKey);
+	}
+	if(!StaleKeys.IsEmpty())
+	{
+		local_UpdateStats();
+	}
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------
+// Skin Functions
+//----------------------------------------------------------------------------------------------------------------
+
 USkeletalMesh* UOmegaSkinFunctions::MergeMeshes_Omega(TArray<USkeletalMesh*> Meshes, USkeletalMesh* BaseMesh)
 {
 	if(BaseMesh)
 	{
-		FSkeletalMeshMergeParams MergeParams;
-		
-		MergeParams.Skeleton = BaseMesh->GetSkeleton();
-		
+		USkeleton* local_skeleton = BaseMesh->GetSkeleton();
+		TArray<USkeletalMesh*> local_meshes;
 		for(auto* TempMesh : Meshes)
 		{
-			if(TempMesh && TempMesh->GetSkeleton()==MergeParams.Skeleton)
+			if(TempMesh && TempMesh->GetSkeleton()==local_skeleton)
 			{
-				MergeParams.MeshesToMerge.Add(TempMesh);
+				local_meshes.Add(TempMesh);
 			}
 		}
-		return USkeletalMergingLibrary::MergeMeshes(MergeParams);
-		
+		return GEngine->GetEngineSubsystem<UOmegaSkinMergeSubsystem>()->Native_GetMergedMesh(local_skeleton, local_meshes);
 	}
 	
 	return nullptr;
 }
 
+void UOmegaSkinFunctions::MergeMeshesAsync_Omega(TArray<USkeletalMesh*> Meshes, USkeletalMesh* BaseMesh, const FOnOmegaSkinMerged& OnMerged)
+{
+	if(!BaseMesh)
+	{
+		OnMerged.ExecuteIfBound(nullptr);
+		return;
+	}
+	USkeleton* local_skeleton = BaseMesh->GetSkeleton();
+	TArray<USkeletalMesh*> local_meshes;
+	for(auto* TempMesh : Meshes)
+	{
+		if(TempMesh && TempMesh->GetSkeleton()==local_skeleton)
+		{
+			local_meshes.Add(TempMesh);
+		}
+	}
+	GEngine->GetEngineSubsystem<UOmegaSkinMergeSubsystem>()->Native_RequestMergedMesh(local_skeleton, local_meshes,
+		[OnMerged](USkeletalMesh* MergedMesh)
+		{
+			OnMerged.ExecuteIfBound(MergedMesh);
+		});
+}
+
 USkeletalMesh* UOmegaSkinFunctions::MergeComponentMeshes_Omega(TArray<USkeletalMeshComponent*> Meshes,
 	USkeletalMesh* BaseMesh)
 {
@@ -280,6 +590,12 @@ void AOmegaSkin::OnConstruction(const FTransform& Transform)
 	Super::OnConstruction(Transform);
 }
 
+void AOmegaSkin::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	local_holdMergedMesh(nullptr);
+	Super::EndPlay(EndPlayReason);
+}
+
 void AOmegaSkin::TrySetAnimation(USkeletalMeshComponent* TargetMesh)
 {
 	if(TargetMesh && AnimationClass && TargetMesh->GetAnimationMode()==EAnimationMode::Type::AnimationBlueprint)
@@ -302,6 +618,40 @@ void AOmegaSkin::local_applyModifiers(USkeletalMeshComponent* MeshComp)
 	}
 }
 
+void AOmegaSkin::local_applyMergedMesh(USkeletalMeshComponent* TargetMesh, USkeletalMesh* MergedMesh)
+{
+	local_holdMergedMesh(MergedMesh);
+	TargetMesh->SetSkeletalMeshAsset(MergedMesh);
+	local_applyModifiers(TargetMesh);
+	//Clean Mesh
+	for(auto* tempComp : GetMeshMergeComponents())
+	{
+		if(tempComp)
+		{
+			tempComp->DestroyComponent();
+		}
+	}
+}
+
+void AOmegaSkin::local_holdMergedMesh(USkeletalMesh* MergedMesh)
+{
+	//Only game worlds hold references. Editor skins are rebuilt on every construction and never end play.
+	if(held_MergedMesh==MergedMesh || !GetWorld() || !GetWorld()->IsGameWorld())
+	{
+		return;
+	}
+	UOmegaSkinMergeSubsystem* MergeSubsystem = GEngine->GetEngineSubsystem<UOmegaSkinMergeSubsystem>();
+	if(held_MergedMesh)
+	{
+		MergeSubsystem->ReleaseMergedMesh(held_MergedMesh);
+	}
+	held_MergedMesh=MergedMesh;
+	if(held_MergedMesh)
+	{
+		MergeSubsystem->AddMergedMeshReference(held_MergedMesh);
+	}
+}
+
 USkeletalMeshComponent* AOmegaSkin::GetCompressedMeshComponent_Implementation()
 {
 	if(UActorComponent* out = GetComponentByClass(USkeletalMeshComponent::StaticClass()))
@@ -346,31 +696,61 @@ void AOmegaSkin::BuildSkin()
 			return;
 		}
 
-		FSkeletalMeshMergeParams MergeParams;
-		MergeParams.Skeleton=MasterSkeleton->GetSkeleton();
-		for(auto* tempComp : GetMeshMergeComponents())
+		merge_Serial++;
+		USkeletalMesh* new_mesh=nullptr;
+		if(bMerge)
 		{
-			if (tempComp && tempComp->GetSkeletalMeshAsset() && tempComp->GetSkeletalMeshAsset()->GetSkeleton()==MasterSkeleton->GetSkeleton())
+			USkeleton* local_skeleton=MasterSkeleton->GetSkeleton();
+			TArray<USkeletalMesh*> local_meshes;
+			for(auto* tempComp : GetMeshMergeComponents())
 			{
-				MergeParams.MeshesToMerge.Add(tempComp->GetSkeletalMeshAsset());
+				if (tempComp && tempComp->GetSkeletalMeshAsset() && tempComp->GetSkeletalMeshAsset()->GetSkeleton()==local_skeleton)
+				{
+					local_meshes.Add(tempComp->GetSkeletalMeshAsset());
+				}
 			}
-		}
 
-		USkeletalMesh* new_mesh=USkeletalMergingLibrary::MergeMeshes(MergeParams);
+			UOmegaSkinMergeSubsystem* MergeSubsystem = GEngine->GetEngineSubsystem<UOmegaSkinMergeSubsystem>();
+			if(bAsyncMerge && GetWorld() && GetWorld()->IsGameWorld())
+			{
+				new_mesh=MergeSubsystem->Native_FindMergedMesh(local_skeleton,local_meshes);
+				if(!new_mesh && !local_meshes.IsEmpty())
+				{
+					//Show the unmerged parts below until the merge is done
+					const int32 local_serial=merge_Serial;
+					TWeakObjectPtr<AOmegaSkin> WeakThis(this);
+					MergeSubsystem->Native_RequestMergedMesh(local_skeleton,local_meshes,[WeakThis,local_serial](USkeletalMesh* MergedMesh)
+					{
+						AOmegaSkin* local_skin=WeakThis.Get();
+						if(MergedMesh && local_skin && local_skin->merge_Serial==local_serial && local_skin->owning_component && local_skin->owning_component->GetTargetMesh())
+						{
+							USkeletalMeshComponent* local_target=local_skin->owning_component->GetTargetMesh();
+							//Drop the master skeleton override materials used while unmerged
+							local_target->EmptyOverrideMaterials();
+							local_skin->local_applyMergedMesh(local_target,MergedMesh);
+						}
+					});
+				}
+			}
+			else if(GetWorld() && GetWorld()->IsGameWorld())
+			{
+				new_mesh=MergeSubsystem->Native_GetMergedMesh(local_skeleton,local_meshes);
+			}
+			else
+			{
+				//Editor construction merges fresh, so edited or re-imported parts show up at once
+				new_mesh=UOmegaSkinMergeSubsystem::Native_MergeMeshesUncached(local_skeleton,local_meshes);
+			}
+		}
 		
 		// Apply mesh
-		if(bMerge && new_mesh)
+		if(new_mesh)
 		{
-			TargetMesh->SetSkeletalMeshAsset(new_mesh);
-			local_applyModifiers(TargetMesh);
-			//Clean Mesh
-			for(auto* tempComp : GetMeshMergeComponents())
-			{
-				tempComp->DestroyComponent();
-			}
+			local_applyMergedMesh(TargetMesh,new_mesh);
 		}
 		else
 		{
+			local_holdMergedMesh(nullptr);
 			if(MasterSkeleton)
 			{
 				TargetMesh->SetSkeletalMeshAsset(MasterSkeleton);
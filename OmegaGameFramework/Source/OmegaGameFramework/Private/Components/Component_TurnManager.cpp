@@ -6,8 +6,14 @@
 
 #include "Functions/OmegaFunctions_TagEvent.h"
 #include "Subsystems/OmegaSubsystem_GameManager.h"
+#include "Functions/OmegaFunctions_ObjectSorter.h"
 
 
+TArray<float> UTurnManagerBase::GetTurnOrderKeys_Implementation(UCombatantComponent* Combatant)
+{
+	return TArray<float>();
+}
+
 // Sets default values for this component's properties
 UTurnBasedManagerComponent::UTurnBasedManagerComponent()
 {
@@ -152,11 +158,22 @@ TArray<UCombatantComponent*> UTurnBasedManagerComponent::GenerateTurnOrder()
 		// Create a copy of the input array to keep the original intact
 		TArray<UCombatantComponent*> TempOrder = TurnOrder;
 
-		// Sort the array using the ShouldCheckedObjectSortFirst function as a comparison
-		TempOrder.Sort([&](UCombatantComponent& A, UCombatantComponent& B)
+		if(TurnManager->bUseTurnOrderKeys)
 		{
-			return TurnManager->ShouldTargetActFirst(&A,&B);
-		});
+			UTurnManagerBase* LocalManager = TurnManager;
+			UOmegaObjectSorterFunctions::Native_SortByKeys<UCombatantComponent>(TempOrder, [LocalManager](UCombatantComponent* Combatant)
+			{
+				return LocalManager->GetTurnOrderKeys(Combatant);
+			}, TurnManager->bTurnOrderKeysDescending);
+		}
+		else
+		{
+			// Sort the array using the ShouldCheckedObjectSortFirst function as a comparison
+			TempOrder.Sort([&](UCombatantComponent& A, UCombatantComponent& B)
+			{
+				return TurnManager->ShouldTargetActFirst(&A,&B);
+			});
+		}
 
 		TurnOrder = TempOrder;
 	}
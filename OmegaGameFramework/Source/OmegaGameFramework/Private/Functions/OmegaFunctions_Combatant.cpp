@@ -158,6 +158,11 @@ void UCombatantFunctions::ApplyEffectFromAsset(UCombatantComponent* Combatant, U
 	}
 }
 
+TArray<float> UCombatantFunctions::ApplyAttributeDamageBatch(const TArray<FOmegaDamageRecord>& Records, UCombatantComponent* Instigator, UObject* Context)
+{
+	return UCombatantComponent::Native_ApplyAttributeDamageBatch(Records, Instigator, Context);
+}
+
 UCombatantComponent* UCombatantFunctions::GetPlayerCombatant(const UObject* WorldContextObject, int32 Index)
 {
 	if(APawn* TempPawn = UGameplayStatics::GetPlayerPawn(WorldContextObject, Index))
@@ -10,6 +10,11 @@ TArray<UObject*> UOmegaObjectSorterClass::FilterObjects_Implementation(const TAr
 	return OutObjects;
 }
 
+TArray<float> UOmegaObjectSorterClass::GetObjectSortKeys_Implementation(UObject* Object, UObject* Context)
+{
+	return TArray<float>();
+}
+
 
 TArray<UObject*> UOmegaObjectSorterFunctions::SortObjectArray(TArray<UObject*> InObjects,
 	UOmegaObjectSorterAsset* Sorter, TSubclassOf<UObject> OutputClass,  UObject* Context)
@@ -21,6 +26,16 @@ TArray<UObject*> UOmegaObjectSorterFunctions::SortObjectArray(TArray<UObject*> I
 		// Create a copy of the input array to keep the original intact
 		SortedArray = Sorter->SorterScript->FilterObjects(InObjects,Context);
 
+		if(Sorter->SorterScript->bUseSortKeys)
+		{
+			UOmegaObjectSorterClass* SorterScript = Sorter->SorterScript;
+			Native_SortByKeys<UObject>(SortedArray, [SorterScript, Context](UObject* Object)
+			{
+				return SorterScript->GetObjectSortKeys(Object, Context);
+			}, SorterScript->bSortKeysDescending);
+			return SortedArray;
+		}
+
 		// Sort the array using the ShouldCheckedObjectSortFirst function as a comparison
 		SortedArray.Sort([&](UObject& A, UObject& B)
 		{
@@ -54,10 +54,13 @@ void UOmegaScriptedEffectFunctions::ApplyEffectScriptToCombatant(TArray<UOmegaSc
 		{
 			TempEffect->OnEffectApplied(Target, Instigator);
 
-			//Spawn Cues
+			//Spawn Cues. Impacts with no combatant have nowhere to play them.
 			for(const TSubclassOf<AOmegaGameplayCue>& TempCue : TempEffect->GetCuesToPlay())
 			{
-				UOmegaGameplayCueFunctions::PlayGameplayCue(Target,TempCue,FTransform(), FHitResult(),Target->GetOwner());
+				if(Target)
+				{
+					UOmegaGameplayCueFunctions::PlayGameplayCue(Target,TempCue,FTransform(), FHitResult(),Target->GetOwner());
+				}
 			}
 		}
 	}
@@ -73,7 +76,10 @@ void UOmegaScriptedEffectFunctions::ApplyScriptedEffectToCombatant(UOmegaScripte
 		//Spawn Cues
 		for(const TSubclassOf<AOmegaGameplayCue>& TempCue : EffectAsset->GameplayCues)
 		{
-			UOmegaGameplayCueFunctions::PlayGameplayCue(Target,TempCue,FTransform(),FHitResult(),Target->GetOwner());
+			if(Target)
+			{
+				UOmegaGameplayCueFunctions::PlayGameplayCue(Target,TempCue,FTransform(),FHitResult(),Target->GetOwner());
+			}
 		}
 	}
 }
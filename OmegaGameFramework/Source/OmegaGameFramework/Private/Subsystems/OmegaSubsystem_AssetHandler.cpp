@@ -14,61 +14,143 @@
 void UOmegaSubsystem_AssetHandler::ClearSortedAssets_All()
 {
 	SortedAssets.Empty();
+	REF_AssetsByClass.Empty();
+	REF_AssetsByCategory.Empty();
+	REF_AssetsByTag.Empty();
+	REF_AssetRecords.Empty();
 }
 
 TArray<UObject*> UOmegaSubsystem_AssetHandler::GetSortedAsset_All()
 {
 	TArray<UObject*> out;
-	TArray<FString> asset_list;
-	SortedAssets.GetKeys(asset_list);
-	for(FString tempName : asset_list)
-	{
-		out.Add(GetSortedAsset_FromLabel(tempName));
-	}
+	SortedAssets.GenerateValueArray(out);
 	return  out;
 }
 
 UObject* UOmegaSubsystem_AssetHandler::GetSortedAsset_FromLabel(const FString& Name)
 {
-	if(SortedAssets.Contains(Name))
+	if(UObject* const* FoundAsset = SortedAssets.Find(Name))
 	{
-		return SortedAssets[Name];
+		return *FoundAsset;
 	}
 	return nullptr;
 }
 
 void UOmegaSubsystem_AssetHandler::Register_SortedAsset(UObject* Asset, FString Name, bool bOverride)
 {
-	if(Asset && (!SortedAssets.Contains(Name) || bOverride))
+	if(!Asset)
 	{
-		SortedAssets.Add(Name,Asset);
+		return;
 	}
+	UObject** ExistingAsset = SortedAssets.Find(Name);
+	if(ExistingAsset && !bOverride)
+	{
+		return;
+	}
+	if(ExistingAsset)
+	{
+		if(*ExistingAsset == Asset)
+		{
+			return;
+		}
+		local_UnindexAsset(*ExistingAsset);
+	}
+	SortedAssets.Add(Name,Asset);
+	local_IndexAsset(Asset);
 }
 
+void UOmegaSubsystem_AssetHandler::local_IndexAsset(UObject* Asset)
+{
+	FOmegaSortedAssetRecord& Record = REF_AssetRecords.FindOrAdd(Asset);
+	// Already indexed under another label
+	if(Record.NumLabels++ > 0)
+	{
+		return;
+	}
+
+	REF_AssetsByClass.FindOrAdd(Asset->GetClass()).Assets.Add(Asset);
+	
+	Record.bHasTagInterface = Asset->GetClass()->ImplementsInterface(UGameplayTagsInterface::StaticClass());
+	if(!Record.bHasTagInterface)
+	{
+		return;
+	}
+	
+	// File the asset under its category and every parent of it, so hierarchy matches are a single lookup.
+	Record.Category = IGameplayTagsInterface::Execute_GetObjectGameplayCategory(Asset);
+	if(Record.Category.IsValid())
+	{
+		for(const FGameplayTag& TempTag : Record.Category.GetGameplayTagParents())
+		{
+			REF_AssetsByCategory.FindOrAdd(TempTag).Assets.Add(Asset);
+		}
+	}
+	Record.Tags = IGameplayTagsInterface::Execute_GetObjectGameplayTags(Asset);
+	for(const FGameplayTag& TempTag : Record.Tags)
+	{
+		REF_AssetsByTag.FindOrAdd(TempTag).Assets.Add(Asset);
+	}
+}
 
+void UOmegaSubsystem_AssetHandler::local_UnindexAsset(UObject* Asset)
+{
+	FOmegaSortedAssetRecord* Record = REF_AssetRecords.Find(Asset);
+	if(!Record || --Record->NumLabels > 0)
+	{
+		return;
+	}
 
-TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_OfClass(UClass* Class)
+	auto RemoveFromBucket = [Asset](auto& Index, const auto& Key)
+	{
+		if(FOmegaSortedAssetBucket* Bucket = Index.Find(Key))
+		{
+			Bucket->Assets.RemoveSingleSwap(Asset, EAllowShrinking::No);
+			if(Bucket->Assets.IsEmpty())
+			{
+				Index.Remove(Key);
+			}
+		}
+	};
+	RemoveFromBucket(REF_AssetsByClass, Asset->GetClass());
+	if(Record->Category.IsValid())
+	{
+		for(const FGameplayTag& TempTag : Record->Category.GetGameplayTagParents())
+		{
+			RemoveFromBucket(REF_AssetsByCategory, TempTag);
+		}
+	}
+	for(const FGameplayTag& TempTag : Record->Tags)
+	{
+		RemoveFromBucket(REF_AssetsByTag, TempTag);
+	}
+	REF_AssetRecords.Remove(Asset);
+}
+
+TArray<UObject*> UOmegaSubsystem_AssetHandler::Native_GetSortedAssets_OfClass(UClass* Class) const
 {
 	TArray<UObject*> out;
-	for (auto* TempAsset : GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->GetSortedAsset_All())
+	if(!Class)
 	{
-		if(TempAsset && TempAsset->GetClass()->IsChildOf(Class))
+		return out;
+	}
+	for(const TPair<UClass*, FOmegaSortedAssetBucket>& Pair : REF_AssetsByClass)
+	{
+		if(Pair.Key && Pair.Key->IsChildOf(Class))
 		{
-			out.Add(TempAsset);
+			out.Append(Pair.Value.Assets);
 		}
 	}
 	return out;
 }
 
-TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_OfCategory(FGameplayTag CategoryTag, UClass* Class)
+TArray<UObject*> UOmegaSubsystem_AssetHandler::Native_GetSortedAssets_OfCategory(const FGameplayTag& CategoryTag, UClass* Class) const
 {
 	TArray<UObject*> out;
-	for (auto* TempAsset : GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->GetSortedAsset_All())
+	if(const FOmegaSortedAssetBucket* Bucket = REF_AssetsByCategory.Find(CategoryTag))
 	{
-		if(TempAsset && (TempAsset->GetClass()->IsChildOf(Class) || !Class) && TempAsset->GetClass()->ImplementsInterface(UGameplayTagsInterface::StaticClass()))
+		for(UObject* TempAsset : Bucket->Assets)
 		{
-			FGameplayTag TempAssetTag = IGameplayTagsInterface::Execute_GetObjectGameplayCategory(TempAsset);
-			if(TempAssetTag.MatchesTag(CategoryTag))
+			if(TempAsset && (!Class || TempAsset->GetClass()->IsChildOf(Class)))
 			{
 				out.Add(TempAsset);
 			}
@@ -77,14 +159,41 @@ TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_OfCategory(FGamepl
 	return out;
 }
 
-TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_WithTags(FGameplayTagContainer Tags, UClass* Class)
+TArray<UObject*> UOmegaSubsystem_AssetHandler::Native_GetSortedAssets_WithTags(const FGameplayTagContainer& Tags, UClass* Class) const
 {
 	TArray<UObject*> out;
-	for (auto* TempAsset : GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->GetSortedAsset_All())
+	if(Tags.IsEmpty())
+	{
+		for(const TPair<UObject*, FOmegaSortedAssetRecord>& Pair : REF_AssetRecords)
+		{
+			if(Pair.Key && Pair.Value.bHasTagInterface && (!Class || Pair.Key->GetClass()->IsChildOf(Class)))
+			{
+				out.Add(Pair.Key);
+			}
+		}
+		return out;
+	}
+	
+	// Walk the smallest bucket of the requested tags and check the rest against the indexed tags.
+	const FOmegaSortedAssetBucket* SmallestBucket = nullptr;
+	for(const FGameplayTag& TempTag : Tags)
+	{
+		const FOmegaSortedAssetBucket* Bucket = REF_AssetsByTag.Find(TempTag);
+		if(!Bucket)
+		{
+			return out;
+		}
+		if(!SmallestBucket || Bucket->Assets.Num() < SmallestBucket->Assets.Num())
+		{
+			SmallestBucket = Bucket;
+		}
+	}
+	for(UObject* TempAsset : SmallestBucket->Assets)
 	{
-		if(TempAsset && (TempAsset->GetClass()->IsChildOf(Class) || !Class) && TempAsset->GetClass()->ImplementsInterface(UGameplayTagsInterface::StaticClass()))
+		if(TempAsset && (!Class || TempAsset->GetClass()->IsChildOf(Class)))
 		{
-			if(IGameplayTagsInterface::Execute_GetObjectGameplayTags(TempAsset).HasAllExact(Tags))
+			const FOmegaSortedAssetRecord* Record = REF_AssetRecords.Find(TempAsset);
+			if(Record && Record->Tags.HasAllExact(Tags))
 			{
 				out.Add(TempAsset);
 			}
@@ -92,3 +201,20 @@ TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_WithTags(FGameplay
 	}
 	return out;
 }
+
+
+
+TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_OfClass(UClass* Class)
+{
+	return GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->Native_GetSortedAssets_OfClass(Class);
+}
+
+TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_OfCategory(FGameplayTag CategoryTag, UClass* Class)
+{
+	return GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->Native_GetSortedAssets_OfCategory(CategoryTag, Class);
+}
+
+TArray<UObject*> UOmegaAssetHandlerFunctions::GetSortedAssets_WithTags(FGameplayTagContainer Tags, UClass* Class)
+{
+	return GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->Native_GetSortedAssets_WithTags(Tags, Class);
+}
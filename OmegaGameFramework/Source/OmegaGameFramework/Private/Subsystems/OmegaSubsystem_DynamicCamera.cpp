@@ -9,6 +9,60 @@
 #include "Engine/LocalPlayer.h"
 #include "Functions/OmegaFunctions_Common.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Algo/BinarySearch.h"
+#include "OmegaGameFramework.h"
+
+DECLARE_CYCLE_STAT(TEXT("Dynamic Camera Blend"), STAT_OmegaDynamicCameraBlend, STATGROUP_Omega);
+
+//----------------------------------------------------------------------------------------------------------------
+// Camera State
+//----------------------------------------------------------------------------------------------------------------
+
+FOmegaDynamicCameraState FOmegaDynamicCameraState::FromCamera(const AOmegaDynamicCamera* Camera)
+{
+	FOmegaDynamicCameraState OutState;
+	OutState.Location = Camera->GetActorLocation();
+	OutState.Rotation = Camera->GetActorRotation();
+	OutState.FieldOfView = Camera->comp_camera->FieldOfView;
+	OutState.ArmLength = Camera->comp_spring->TargetArmLength;
+	OutState.ArmLocation = Camera->comp_spring->GetRelativeLocation();
+	OutState.ArmRotation = Camera->comp_spring->GetRelativeRotation();
+	OutState.SocketOffset = Camera->comp_spring->SocketOffset;
+	OutState.TargetOffset = Camera->comp_spring->TargetOffset;
+	return OutState;
+}
+
+void FOmegaDynamicCameraState::ApplyTo(AOmegaDynamicCamera* Camera) const
+{
+	Camera->SetActorLocationAndRotation(Location, Rotation);
+	Camera->comp_camera->SetFieldOfView(FieldOfView);
+	Camera->comp_spring->TargetArmLength = ArmLength;
+	Camera->comp_spring->SocketOffset = SocketOffset;
+	Camera->comp_spring->TargetOffset = TargetOffset;
+	Camera->comp_spring->SetRelativeLocationAndRotation(ArmLocation, ArmRotation);
+}
+
+void FOmegaDynamicCameraState::InterpTo(const FOmegaDynamicCameraState& Target, float DeltaTime, float Speed)
+{
+	if(Speed <= 0.0)
+	{
+		*this = Target;
+		return;
+	}
+	const float Alpha = FMath::Clamp(DeltaTime * Speed, 0.0f, 1.0f);
+	Location += (Target.Location - Location) * Alpha;
+	Rotation += (Target.Rotation - Rotation).GetNormalized() * Alpha;
+	FieldOfView += (Target.FieldOfView - FieldOfView) * Alpha;
+	ArmLength += (Target.ArmLength - ArmLength) * Alpha;
+	ArmLocation += (Target.ArmLocation - ArmLocation) * Alpha;
+	ArmRotation += (Target.ArmRotation - ArmRotation).GetNormalized() * Alpha;
+	SocketOffset += (Target.SocketOffset - SocketOffset) * Alpha;
+	TargetOffset += (Target.TargetOffset - TargetOffset) * Alpha;
+}
+
+//----------------------------------------------------------------------------------------------------------------
+// Subsystem
+//----------------------------------------------------------------------------------------------------------------
 
 void UOmegaDynamicCameraSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -18,11 +72,17 @@ void UOmegaDynamicCameraSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 void UOmegaDynamicCameraSubsystem::Tick(float DeltaTime)
 {
 	last_delta=DeltaTime;
-	if(AOmegaDynamicCamera* cam_source = GetSourceCamera())
+	if(local_GetActiveOverrideCamera() || !active_cameras.IsEmpty())
 	{
-		if(AOmegaDynamicCamera* cam_master = GetDynamicCamera())
+		SCOPE_CYCLE_COUNTER(STAT_OmegaDynamicCameraBlend);
+		FOmegaDynamicCameraState TargetState;
+		float TargetSpeed;
+		if(GetBlendedSourceState(TargetState, TargetSpeed))
 		{
-			InterpToTarget(cam_source,cam_master,cam_source->InterpSpeed);
+			AOmegaDynamicCamera* cam_master = GetDynamicCamera();
+			FOmegaDynamicCameraState MasterState = FOmegaDynamicCameraState::FromCamera(cam_master);
+			MasterState.InterpTo(TargetState, DeltaTime, TargetSpeed);
+			MasterState.ApplyTo(cam_master);
 		}
 	}
 	if(is_DynamicCamerActive)
@@ -48,11 +108,13 @@ void UOmegaDynamicCameraSubsystem::Tick(float DeltaTime)
 
 void UOmegaDynamicCameraSubsystem::SnapToCurrentSource()
 {
-	if(AOmegaDynamicCamera* cam_source = GetSourceCamera())
+	FOmegaDynamicCameraState TargetState;
+	float TargetSpeed;
+	if(GetBlendedSourceState(TargetState, TargetSpeed))
 	{
 		if(AOmegaDynamicCamera* cam_master = GetDynamicCamera())
 		{
-			InterpToTarget(cam_source,cam_master,0.0);
+			TargetState.ApplyTo(cam_master);
 		}
 	}
 }
@@ -63,7 +125,7 @@ void UOmegaDynamicCameraSubsystem::SetAllCamerasWithTags_Active(FGameplayTagCont
 	{
 		if(TempCam && UOmegaGameFrameworkBPLibrary::GetObjectGameplayTags(TempCam).HasAnyExact(Tags))
 		{
-			TempCam->CameraActive=bActive;
+			TempCam->SetCameraActive(bActive);
 		}
 	}
 }
@@ -81,38 +143,91 @@ AOmegaDynamicCamera* UOmegaDynamicCameraSubsystem::GetDynamicCamera()
 	{
 		master_camera = GetWorld()->SpawnActorDeferred<AOmegaDynamicCamera>(GetDynamicCameraClass(),FTransform());
 		master_camera->FinishSpawning(FTransform());
+		// The master registers itself on BeginPlay like any camera, but is never a source
+		SetCameraSourceRegistered(master_camera, false);
 	}
 	return master_camera;
 }
 
+AOmegaDynamicCamera* UOmegaDynamicCameraSubsystem::local_GetActiveOverrideCamera() const
+{
+	return IsValid(override_camera) && override_camera->CameraActive ? override_camera : nullptr;
+}
+
 AOmegaDynamicCamera* UOmegaDynamicCameraSubsystem::GetSourceCamera()
 {
-	if(override_camera && override_camera->CameraActive)
+	if(AOmegaDynamicCamera* ActiveOverride = local_GetActiveOverrideCamera())
 	{
-		return override_camera;
+		return ActiveOverride;
 	}
-	AOmegaDynamicCamera* out=nullptr;
-	for(AOmegaDynamicCamera* temp_cam : source_cameras)
+	return active_cameras.IsEmpty() ? nullptr : active_cameras[0];
+}
+
+bool UOmegaDynamicCameraSubsystem::GetBlendedSourceState(FOmegaDynamicCameraState& State, float& InterpSpeed)
+{
+	if(const AOmegaDynamicCamera* ActiveOverride = local_GetActiveOverrideCamera())
+	{
+		State = FOmegaDynamicCameraState::FromCamera(ActiveOverride);
+		InterpSpeed = ActiveOverride->InterpSpeed;
+		return true;
+	}
+	if(active_cameras.IsEmpty())
 	{
-		if(temp_cam &&
-			temp_cam!=GetDynamicCamera() &&
-			!temp_cam->IsActorBeingDestroyed()
-			&& temp_cam->CameraActive) //If camera is valid & is NOT the Master Camera.
+		return false;
+	}
+	const AOmegaDynamicCamera* TopCamera = active_cameras[0];
+	State = FOmegaDynamicCameraState::FromCamera(TopCamera);
+	InterpSpeed = TopCamera->InterpSpeed;
+
+	// Blend opted-in cameras sharing the top priority. Rotations are averaged as quaternions.
+	float TotalWeight = TopCamera->BlendWeight;
+	if(!TopCamera->bBlendWithPeers || active_cameras.Num() < 2 || active_cameras[1]->Priority != TopCamera->Priority || TotalWeight <= 0.0)
+	{
+		return true;
+	}
+	FOmegaDynamicCameraState SumState = State;
+	SumState.Location *= TotalWeight;
+	SumState.FieldOfView *= TotalWeight;
+	SumState.ArmLength *= TotalWeight;
+	SumState.ArmLocation *= TotalWeight;
+	SumState.SocketOffset *= TotalWeight;
+	SumState.TargetOffset *= TotalWeight;
+	const FQuat TopRotation = State.Rotation.Quaternion();
+	const FQuat TopArmRotation = State.ArmRotation.Quaternion();
+	FQuat SumRotation = TopRotation * TotalWeight;
+	FQuat SumArmRotation = TopArmRotation * TotalWeight;
+	for(int32 i = 1; i < active_cameras.Num() && active_cameras[i]->Priority == TopCamera->Priority; i++)
+	{
+		const AOmegaDynamicCamera* TempCam = active_cameras[i];
+		const float TempWeight = TempCam->BlendWeight;
+		if(!TempCam->bBlendWithPeers || TempWeight <= 0.0)
 		{
-			if(out) //if a valid check camera has been set
-			{
-				if(temp_cam->CameraActive && temp_cam->Priority >= out->Priority)
-				{
-					out=temp_cam;
-				}
-			}
-			else// if not set this as the check camera
-			{
-				out=temp_cam;
-			}
+			continue;
 		}
+		const FOmegaDynamicCameraState TempState = FOmegaDynamicCameraState::FromCamera(TempCam);
+		SumState.Location += TempState.Location * TempWeight;
+		SumState.FieldOfView += TempState.FieldOfView * TempWeight;
+		SumState.ArmLength += TempState.ArmLength * TempWeight;
+		SumState.ArmLocation += TempState.ArmLocation * TempWeight;
+		SumState.SocketOffset += TempState.SocketOffset * TempWeight;
+		SumState.TargetOffset += TempState.TargetOffset * TempWeight;
+		// Keep quaternions in the same hemisphere so the sum does not cancel out
+		FQuat TempRotation = TempState.Rotation.Quaternion();
+		FQuat TempArmRotation = TempState.ArmRotation.Quaternion();
+		SumRotation += ((TempRotation | TopRotation) < 0.0 ? -TempRotation : TempRotation) * TempWeight;
+		SumArmRotation += ((TempArmRotation | TopArmRotation) < 0.0 ? -TempArmRotation : TempArmRotation) * TempWeight;
+		TotalWeight += TempWeight;
 	}
-	return out;
+	const float InvWeight = 1.0 / TotalWeight;
+	State.Location = SumState.Location * InvWeight;
+	State.FieldOfView = SumState.FieldOfView * InvWeight;
+	State.ArmLength = SumState.ArmLength * InvWeight;
+	State.ArmLocation = SumState.ArmLocation * InvWeight;
+	State.SocketOffset = SumState.SocketOffset * InvWeight;
+	State.TargetOffset = SumState.TargetOffset * InvWeight;
+	State.Rotation = SumRotation.GetNormalized().Rotator();
+	State.ArmRotation = SumArmRotation.GetNormalized().Rotator();
+	return true;
 }
 
 void UOmegaDynamicCameraSubsystem::SetCameraSourceRegistered(AOmegaDynamicCamera* Camera, bool IsActive)
@@ -127,6 +242,23 @@ void UOmegaDynamicCameraSubsystem::SetCameraSourceRegistered(AOmegaDynamicCamera
 		{
 			source_cameras.Remove(Camera);
 		}
+		Native_UpdateSourceCamera(Camera);
+	}
+}
+
+void UOmegaDynamicCameraSubsystem::Native_UpdateSourceCamera(AOmegaDynamicCamera* Camera)
+{
+	if(!Camera)
+	{
+		return;
+	}
+	active_cameras.Remove(Camera);
+	if(Camera->CameraActive && Camera != master_camera && source_cameras.Contains(Camera))
+	{
+		// Goes ahead of cameras with the same priority, so the most recent change wins ties
+		const int32 InsertIndex = Algo::LowerBoundBy(active_cameras, Camera->Priority,
+			[](const AOmegaDynamicCamera* TempCam) { return TempCam->Priority; }, TGreater<int32>());
+		active_cameras.Insert(Camera, InsertIndex);
 	}
 }
 
@@ -149,16 +281,9 @@ void UOmegaDynamicCameraSubsystem::InterpToTarget(AOmegaDynamicCamera* cam_sourc
 {
 	if(cam_source && cam_master)
 	{
-		const FVector loc_master = GetDynamicCamera()->GetActorLocation();
-		cam_master->SetActorLocation(UKismetMathLibrary::VInterpTo(loc_master,cam_source->GetActorLocation(),last_delta,speed));
-		cam_master->SetActorRotation(UKismetMathLibrary::RInterpTo(cam_master->GetActorRotation(),cam_source->GetActorRotation(),last_delta,speed));
-		cam_master->comp_camera->SetFieldOfView(UKismetMathLibrary::FInterpTo(cam_master->comp_camera->FieldOfView,cam_source->comp_camera->FieldOfView,last_delta,speed));
-
-		cam_master->comp_spring->TargetArmLength=UKismetMathLibrary::FInterpTo(cam_master->comp_spring->TargetArmLength,cam_source->comp_spring->TargetArmLength,last_delta,speed);
-		cam_master->comp_spring->SetRelativeLocation(UKismetMathLibrary::VInterpTo(cam_master->comp_spring->GetRelativeLocation(),cam_source->comp_spring->GetRelativeLocation(),last_delta,speed));
-		cam_master->comp_spring->SetRelativeRotation(UKismetMathLibrary::RInterpTo(cam_master->comp_spring->GetRelativeRotation(),cam_source->comp_spring->GetRelativeRotation(),last_delta,speed));
-		cam_master->comp_spring->SocketOffset=UKismetMathLibrary::VInterpTo(cam_master->comp_spring->SocketOffset,cam_source->comp_spring->SocketOffset,last_delta,speed);
-		cam_master->comp_spring->TargetOffset=UKismetMathLibrary::VInterpTo(cam_master->comp_spring->TargetOffset,cam_source->comp_spring->TargetOffset,last_delta,speed);
+		FOmegaDynamicCameraState MasterState = FOmegaDynamicCameraState::FromCamera(cam_master);
+		MasterState.InterpTo(FOmegaDynamicCameraState::FromCamera(cam_source), last_delta, speed);
+		MasterState.ApplyTo(cam_master);
 	}
 }
 
@@ -166,7 +291,7 @@ void UOmegaDynamicCameraSubsystem::SetOverrideCamera(AOmegaDynamicCamera* Camera
 {
 	if(Camera)
 	{
-		Camera->CameraActive=true;
+		Camera->SetCameraActive(true);
 		override_camera=Camera;
 	}
 	else
@@ -366,8 +491,58 @@ TArray<UObject*> AOmegaDynamicCamera::GetValidSources()
 
 void AOmegaDynamicCamera::BeginPlay()
 {
-	UGameplayStatics::GetPlayerController(this,0)->GetLocalPlayer()->GetSubsystem<UOmegaDynamicCameraSubsystem>()->SetCameraSourceRegistered(this,true);
+	if(UOmegaDynamicCameraSubsystem* LocalSubsystem = GetCameraSubsystem())
+	{
+		LocalSubsystem->SetCameraSourceRegistered(this,true);
+	}
 	Super::BeginPlay();
 }
 
+void AOmegaDynamicCamera::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(UOmegaDynamicCameraSubsystem* LocalSubsystem = GetCameraSubsystem())
+	{
+		LocalSubsystem->SetCameraSourceRegistered(this,false);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+UOmegaDynamicCameraSubsystem* AOmegaDynamicCamera::GetCameraSubsystem() const
+{
+	if(REF_Subsystem)
+	{
+		return REF_Subsystem;
+	}
+	const APlayerController* LocalPlayer = UGameplayStatics::GetPlayerController(this,0);
+	if(LocalPlayer && LocalPlayer->GetLocalPlayer())
+	{
+		return LocalPlayer->GetLocalPlayer()->GetSubsystem<UOmegaDynamicCameraSubsystem>();
+	}
+	return nullptr;
+}
+
+void AOmegaDynamicCamera::SetCameraPriority(int32 NewPriority)
+{
+	if(Priority != NewPriority)
+	{
+		Priority = NewPriority;
+		if(UOmegaDynamicCameraSubsystem* LocalSubsystem = HasActorBegunPlay() ? GetCameraSubsystem() : nullptr)
+		{
+			LocalSubsystem->Native_UpdateSourceCamera(this);
+		}
+	}
+}
+
+void AOmegaDynamicCamera::SetCameraActive(bool bActive)
+{
+	if(CameraActive != bActive)
+	{
+		CameraActive = bActive;
+		if(UOmegaDynamicCameraSubsystem* LocalSubsystem = HasActorBegunPlay() ? GetCameraSubsystem() : nullptr)
+		{
+			LocalSubsystem->Native_UpdateSourceCamera(this);
+		}
+	}
+}
+
 
@@ -0,0 +1,44 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+
+#include "Subsystems/OmegaSubsystem_Effects.h"
+
+#include "OmegaGameFramework.h"
+#include "Components/Component_Combatant.h"
+
+DECLARE_CYCLE_STAT(TEXT("Data Effects Update"), STAT_OmegaDataEffectsUpdate, STATGROUP_Omega);
+
+
+void UOmegaEffectSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaDataEffectsUpdate);
+
+	// Triggered effects can add or remove effects on other combatants, so iterate a copy.
+	const TArray<UCombatantComponent*> LocalCombatants = DataEffectCombatants;
+	for(UCombatantComponent* TempCombatant : LocalCombatants)
+	{
+		if(!IsValid(TempCombatant) || !TempCombatant->Native_AdvanceDataEffects(DeltaTime))
+		{
+			DataEffectCombatants.RemoveSingleSwap(TempCombatant, EAllowShrinking::No);
+		}
+	}
+}
+
+void UOmegaEffectSubsystem::Deinitialize()
+{
+	DataEffectCombatants.Empty();
+	Super::Deinitialize();
+}
+
+void UOmegaEffectSubsystem::Native_RegisterDataEffects(UCombatantComponent* Combatant)
+{
+	if(Combatant)
+	{
+		DataEffectCombatants.AddUnique(Combatant);
+	}
+}
+
+void UOmegaEffectSubsystem::Native_UnregisterDataEffects(UCombatantComponent* Combatant)
+{
+	DataEffectCombatants.RemoveSingleSwap(Combatant, EAllowShrinking::No);
+}
@@ -6,12 +6,24 @@
 #include "JsonBlueprintFunctionLibrary.h"
 #include "Engine/GameInstance.h"
 #include "Subsystems/OmegaSubsystem_AssetHandler.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// Evicted entries are written in batches of this size
+static constexpr int32 OmegaLogArchiveBatch = 64;
 
 void UOmegaGameManager::Initialize(FSubsystemCollectionBase& Colection)
 {
 #if !PLATFORM_ANDROID
 	GEngine->GetEngineSubsystem<UOmegaSubsystem_AssetHandler>()->ClearSortedAssets_All();
 #endif
+	const UOmegaSettings* Settings = GetDefault<UOmegaSettings>();
+	MaxLogEntry = FMath::Max(Settings->GameplayLogCapacity, 1);
+	LocalLog.SetCapacity(MaxLogEntry);
+	if(Settings->bArchiveEvictedGameplayLog)
+	{
+		LogArchivePath = FPaths::ProjectLogDir() / TEXT("OmegaGameplayLog.log");
+	}
 	for(TSubclassOf<UOmegaGameplayModule> TempModule : GetMutableDefault<UOmegaSettings>()->GetGameplayModuleClasses())
 	{
 		if(TempModule)
@@ -27,6 +39,7 @@ void UOmegaGameManager::Deinitialize()
 	{
 		TempModule->Shutdown();
 	}
+	FlushGameplayLogArchive();
 	Super::Deinitialize();
 }
 
@@ -79,32 +92,70 @@ TArray<UOmegaGameplayModule*> UOmegaGameManager::GetGameplayModules()
 void UOmegaGameManager::FireGlobalEvent(FName Event, UObject* Context)
 {
 	OnGlobalEvent.Broadcast(Event, Context);
+	if(FOmegaGlobalEventListeners* Listeners = GlobalEventListeners.Find(Event))
+	{
+		// Copied, since listeners can add new buckets to the map while it is broadcasting.
+		const FOmegaGlobalEventListeners LocalListeners = *Listeners;
+		LocalListeners.Broadcast(Context);
+		if(FOmegaGlobalEventListeners* RemainingListeners = GlobalEventListeners.Find(Event); RemainingListeners && !RemainingListeners->IsBound())
+		{
+			GlobalEventListeners.Remove(Event);
+		}
+	}
 }
 
 void UOmegaGameManager::FireTaggedGlobalEvent(FGameplayTag Event, UObject* Context)
 {
 	OnTaggedGlobalEvent.Broadcast(Event,Context);
+	if(FOmegaGlobalEventListeners* Listeners = TaggedGlobalEventListeners.Find(Event))
+	{
+		const FOmegaGlobalEventListeners LocalListeners = *Listeners;
+		LocalListeners.Broadcast(Context);
+		if(FOmegaGlobalEventListeners* RemainingListeners = TaggedGlobalEventListeners.Find(Event); RemainingListeners && !RemainingListeners->IsBound())
+		{
+			TaggedGlobalEventListeners.Remove(Event);
+		}
+	}
 }
 
 void UOmegaGameManager::SetFlagActive(FString Flag, bool bActive)
 {
-	if(IsFlagActive(Flag) != bActive)
+	const FName FlagName(*Flag);
+	if(FlagIndices.Contains(FlagName) == bActive)
+	{
+		return;
+	}
+	
+	if(bActive)
+	{
+		FlagIndices.Add(FlagName, Flags.Add(Flag));
+	}
+	else
 	{
-		if(bActive)
+		// Swap the last flag into the removed slot.
+		const int32 FlagIndex = FlagIndices.FindAndRemoveChecked(FlagName);
+		Flags.RemoveAtSwap(FlagIndex, 1, EAllowShrinking::No);
+		if(Flags.IsValidIndex(FlagIndex))
 		{
-			Flags.AddUnique(Flag);
+			FlagIndices.Add(FName(*Flags[FlagIndex]), FlagIndex);
 		}
-		else
+	}
+	OnFlagStateChange.Broadcast(Flag, bActive);
+	
+	if(FOmegaFlagListeners* Listeners = FlagListeners.Find(FlagName))
+	{
+		const FOmegaFlagListeners LocalListeners = *Listeners;
+		LocalListeners.Broadcast(bActive);
+		if(FOmegaFlagListeners* RemainingListeners = FlagListeners.Find(FlagName); RemainingListeners && !RemainingListeners->IsBound())
 		{
-			Flags.Remove(Flag);
+			FlagListeners.Remove(FlagName);
 		}
-		OnFlagStateChange.Broadcast(Flag, bActive);
 	}
 }
 
 bool UOmegaGameManager::IsFlagActive(FString Flag)
 {
-	return Flags.Contains(Flag);
+	return FlagIndices.Contains(FName(*Flag));
 }
 
 void UOmegaGameManager::ClearAllFlags()
@@ -115,16 +166,35 @@ void UOmegaGameManager::ClearAllFlags()
 		SetFlagActive(TempFlag, false);	
 	}
 	Flags.Empty();
+	FlagIndices.Empty();
 }
 
 
 
 void UOmegaGameManager::AddGameplayLog(const FString& String, const FString& LogCategory)
 {
+	if(LocalLog.GetCapacity() != MaxLogEntry)
+	{
+		LocalLog.SetCapacity(MaxLogEntry);
+	}
 	FGameplayLogEntry TempEntry;
 	TempEntry.Log = String;
 	TempEntry.LogCategory = LogCategory;
-	LocalLog.Add(TempEntry);
+
+	if(LogArchivePath.IsEmpty())
+	{
+		LocalLog.Add(MoveTemp(TempEntry), LogCategory);
+		return;
+	}
+	FGameplayLogEntry EvictedEntry;
+	if(LocalLog.Add(MoveTemp(TempEntry), LogCategory, &EvictedEntry))
+	{
+		PendingLogArchive.Add(FString::Printf(TEXT("[%s] %s"), *EvictedEntry.LogCategory, *EvictedEntry.Log));
+		if(PendingLogArchive.Num() >= OmegaLogArchiveBatch)
+		{
+			FlushGameplayLogArchive();
+		}
+	}
 }
 
 void UOmegaGameManager::ClearLog()
@@ -133,27 +203,47 @@ void UOmegaGameManager::ClearLog()
 }
 
 TArray<FString> UOmegaGameManager::GetGameplayLog()
+{
+	int32 LocalTotal;
+	return GetGameplayLogPage(0, -1, LocalTotal);
+}
+
+TArray<FString> UOmegaGameManager::GetGameplayLogOfCategory(const FString& LogCategory)
+{
+	int32 LocalTotal;
+	return GetGameplayLogOfCategoryPage(LogCategory, 0, -1, LocalTotal);
+}
+
+TArray<FString> UOmegaGameManager::GetGameplayLogPage(int32 Start, int32 Count, int32& TotalEntries)
 {
 	TArray<FString> LocalStrings;
-	for(FGameplayLogEntry TempEntry : LocalLog)
+	TotalEntries = LocalLog.Num();
+	LocalStrings.Reserve(Count < 0 ? TotalEntries : FMath::Min(Count, TotalEntries));
+	LocalLog.ForEachInPage(Start, Count, [&LocalStrings](const FGameplayLogEntry& TempEntry)
 	{
 		LocalStrings.Add(TempEntry.Log);
-	}
-	LocalStrings.SetNum(MaxLogEntry);
+	});
 	return LocalStrings;
 }
 
-TArray<FString> UOmegaGameManager::GetGameplayLogOfCategory(const FString& LogCategory)
-{TArray<FString> LocalStrings;
-	for(FGameplayLogEntry TempEntry : LocalLog)
+TArray<FString> UOmegaGameManager::GetGameplayLogOfCategoryPage(const FString& LogCategory, int32 Start, int32 Count, int32& TotalEntries)
+{
+	TArray<FString> LocalStrings;
+	TotalEntries = LocalLog.NumOfKey(LogCategory);
+	LocalStrings.Reserve(Count < 0 ? TotalEntries : FMath::Min(Count, TotalEntries));
+	LocalLog.ForEachOfKeyInPage(LogCategory, Start, Count, [&LocalStrings](const FGameplayLogEntry& TempEntry)
 	{
-		if(TempEntry.LogCategory == LogCategory)
-		{
-			LocalStrings.Add(TempEntry.Log);
-		}
-	}
-	LocalStrings.SetNum(MaxLogEntry);
+		LocalStrings.Add(TempEntry.Log);
+	});
 	return LocalStrings;
-	
 }
 
+void UOmegaGameManager::FlushGameplayLogArchive()
+{
+	if(PendingLogArchive.IsEmpty() || LogArchivePath.IsEmpty())
+	{
+		return;
+	}
+	FFileHelper::SaveStringArrayToFile(PendingLogArchive, *LogArchivePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+	PendingLogArchive.Reset();
+}
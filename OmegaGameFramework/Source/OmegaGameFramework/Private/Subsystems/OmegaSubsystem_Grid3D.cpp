@@ -2,11 +2,255 @@
 
 
 #include "Subsystems/OmegaSubsystem_Grid3D.h"
+#include "Algo/Reverse.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
+// =====================================================================================================
+// Cost Grid
+// =====================================================================================================
+
+void FOmegaGrid3D_CostGrid::Reset(FIntVector InGridSize)
+{
+	GridSize=FIntVector(FMath::Max(InGridSize.X,0),FMath::Max(InGridSize.Y,0),FMath::Max(InGridSize.Z,0));
+	const int32 tile_count=GridSize.X*GridSize.Y*GridSize.Z;
+	Costs.Init(1.0,tile_count);
+	BlocksLineOfEffect.Init(false,tile_count);
+	Occupied.Init(false,tile_count);
+	MinCost=1.0;
+}
+
+bool FOmegaGrid3D_CostGrid::IsValidCoordinate(const FIntVector& Coordinate) const
+{
+	return Coordinate.X>=0 && Coordinate.Y>=0 && Coordinate.Z>=0
+		&& Coordinate.X<GridSize.X && Coordinate.Y<GridSize.Y && Coordinate.Z<GridSize.Z;
+}
+
+int32 FOmegaGrid3D_CostGrid::GetIndex(const FIntVector& Coordinate) const
+{
+	if(!IsValidCoordinate(Coordinate))
+	{
+		return INDEX_NONE;
+	}
+	return (Coordinate.X*GridSize.Y+Coordinate.Y)*GridSize.Z+Coordinate.Z;
+}
+
+FIntVector FOmegaGrid3D_CostGrid::GetCoordinate(int32 Index) const
+{
+	return FIntVector(Index/(GridSize.Y*GridSize.Z),(Index/GridSize.Z)%GridSize.Y,Index%GridSize.Z);
+}
+
+bool FOmegaGrid3D_CostGrid::CanEnter(int32 Index, const FOmegaGrid3D_PathParams& Params) const
+{
+	return Costs.IsValidIndex(Index) && Costs[Index]>=0 && !(Params.bOccupiedBlocksMovement && Occupied[Index]);
+}
+
+void FOmegaGrid3D_CostGrid::GetNeighbours(int32 Index, const FOmegaGrid3D_PathParams& Params, TArray<int32, TInlineAllocator<6>>& OutNeighbours) const
+{
+	static const FIntVector Offsets[6] = {
+		FIntVector(1,0,0), FIntVector(-1,0,0), FIntVector(0,1,0), FIntVector(0,-1,0), FIntVector(0,0,1), FIntVector(0,0,-1) };
+
+	OutNeighbours.Reset();
+	const FIntVector coord=GetCoordinate(Index);
+	const int32 offset_count = Params.bAllowVertical ? 6 : 4;
+	for(int32 i=0; i<offset_count; ++i)
+	{
+		const int32 neighbour=GetIndex(coord+Offsets[i]);
+		if(neighbour!=INDEX_NONE)
+		{
+			OutNeighbours.Add(neighbour);
+		}
+	}
+}
+
+bool FOmegaGrid3D_CostGrid::FindPath(const FIntVector& Start, const FIntVector& Goal, const FOmegaGrid3D_PathParams& Params, TArray<FIntVector>& OutPath, float* OutCost) const
+{
+	OutPath.Reset();
+	const int32 start_index=GetIndex(Start);
+	const int32 goal_index=GetIndex(Goal);
+	if(start_index==INDEX_NONE || goal_index==INDEX_NONE || Costs[goal_index]<0)
+	{
+		return false;
+	}
+
+	struct FOpenNode
+	{
+		int32 Index;
+		float Score;
+		bool operator<(const FOpenNode& Other) const { return Score<Other.Score; }
+	};
+
+	const float heuristic_scale=FMath::Max(MinCost,0.0f);
+	auto Heuristic=[&](int32 Index)
+	{
+		const FIntVector delta=GetCoordinate(Index)-Goal;
+		return (FMath::Abs(delta.X)+FMath::Abs(delta.Y)+FMath::Abs(delta.Z))*heuristic_scale;
+	};
+
+	TArray<float> cost_so_far;
+	cost_so_far.Init(TNumericLimits<float>::Max(),Costs.Num());
+	TArray<int32> came_from;
+	came_from.Init(INDEX_NONE,Costs.Num());
+	TArray<FOpenNode> open_set;
+	TArray<int32, TInlineAllocator<6>> neighbours;
+
+	cost_so_far[start_index]=0;
+	open_set.HeapPush({start_index,Heuristic(start_index)});
+	while(!open_set.IsEmpty())
+	{
+		FOpenNode current;
+		open_set.HeapPop(current,EAllowShrinking::No);
+		if(current.Index==goal_index)
+		{
+			break;
+		}
+		// Skip stale heap entries
+		if(current.Score>cost_so_far[current.Index]+Heuristic(current.Index))
+		{
+			continue;
+		}
+		GetNeighbours(current.Index,Params,neighbours);
+		for(const int32 next : neighbours)
+		{
+			const bool bIsOccupiedGoal = next==goal_index && Params.bAllowOccupiedGoal;
+			if(!CanEnter(next,Params) && !bIsOccupiedGoal)
+			{
+				continue;
+			}
+			const float new_cost=cost_so_far[current.Index]+Costs[next];
+			if(new_cost<cost_so_far[next])
+			{
+				cost_so_far[next]=new_cost;
+				came_from[next]=current.Index;
+				open_set.HeapPush({next,new_cost+Heuristic(next)});
+			}
+		}
+	}
+
+	if(start_index!=goal_index && came_from[goal_index]==INDEX_NONE)
+	{
+		return false;
+	}
+	for(int32 step=goal_index; step!=INDEX_NONE; step=came_from[step])
+	{
+		OutPath.Add(GetCoordinate(step));
+	}
+	Algo::Reverse(OutPath);
+	if(OutCost)
+	{
+		*OutCost=cost_so_far[goal_index];
+	}
+	return true;
+}
+
+void FOmegaGrid3D_CostGrid::GetReachable(const FIntVector& Start, float MaxCost, const FOmegaGrid3D_PathParams& Params, TArray<FIntVector>& OutCoordinates, TArray<float>* OutCosts) const
+{
+	OutCoordinates.Reset();
+	if(OutCosts)
+	{
+		OutCosts->Reset();
+	}
+	const int32 start_index=GetIndex(Start);
+	if(start_index==INDEX_NONE)
+	{
+		return;
+	}
+
+	struct FOpenNode
+	{
+		int32 Index;
+		float Cost;
+		bool operator<(const FOpenNode& Other) const { return Cost<Other.Cost; }
+	};
+
+	TMap<int32,float> cost_so_far;
+	TArray<FOpenNode> open_set;
+	TArray<int32, TInlineAllocator<6>> neighbours;
+
+	cost_so_far.Add(start_index,0);
+	open_set.HeapPush({start_index,0});
+	while(!open_set.IsEmpty())
+	{
+		FOpenNode current;
+		open_set.HeapPop(current,EAllowShrinking::No);
+		if(current.Cost>cost_so_far.FindChecked(current.Index))
+		{
+			continue;
+		}
+		GetNeighbours(current.Index,Params,neighbours);
+		for(const int32 next : neighbours)
+		{
+			if(!CanEnter(next,Params))
+			{
+				continue;
+			}
+			const float new_cost=current.Cost+Costs[next];
+			if(new_cost>MaxCost)
+			{
+				continue;
+			}
+			const float* existing_cost=cost_so_far.Find(next);
+			if(!existing_cost || new_cost<*existing_cost)
+			{
+				cost_so_far.Add(next,new_cost);
+				open_set.HeapPush({next,new_cost});
+			}
+		}
+	}
+
+	OutCoordinates.Reserve(cost_so_far.Num());
+	for(const TPair<int32,float>& Pair : cost_so_far)
+	{
+		OutCoordinates.Add(GetCoordinate(Pair.Key));
+		if(OutCosts)
+		{
+			OutCosts->Add(Pair.Value);
+		}
+	}
+}
+
+void FOmegaGrid3D_CostGrid::GetReachableBatch(const TArray<FIntVector>& Starts, float MaxCost, const FOmegaGrid3D_PathParams& Params, TArray<TArray<FIntVector>>& OutCoordinates) const
+{
+	OutCoordinates.SetNum(Starts.Num());
+	ParallelFor(Starts.Num(),[&](int32 i)
+	{
+		GetReachable(Starts[i],MaxCost,Params,OutCoordinates[i]);
+	});
+}
+
+bool FOmegaGrid3D_CostGrid::HasLineOfEffect(const FIntVector& Start, const FIntVector& End) const
+{
+	if(!IsValidCoordinate(Start) || !IsValidCoordinate(End))
+	{
+		return false;
+	}
+	// DDA line walk, one rounded cell per step along the longest axis. Endpoints excluded.
+	const FIntVector delta=End-Start;
+	const int32 steps=FMath::Max3(FMath::Abs(delta.X),FMath::Abs(delta.Y),FMath::Abs(delta.Z));
+	for(int32 i=1; i<steps; ++i)
+	{
+		const float alpha=static_cast<float>(i)/steps;
+		const FIntVector cell(
+			Start.X+FMath::RoundToInt(delta.X*alpha),
+			Start.Y+FMath::RoundToInt(delta.Y*alpha),
+			Start.Z+FMath::RoundToInt(delta.Z*alpha));
+		if(BlocksLineOfEffect[GetIndex(cell)])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// =====================================================================================================
+// Tilemap Component
+// =====================================================================================================
+
 UOmegaGrid3D_Map::UOmegaGrid3D_Map()
 {
 	GridSize=FIntVector(20,20,1);
@@ -75,41 +319,249 @@ void UOmegaGrid3D_Map::DestroyTiles()
 			tempTile->K2_DestroyActor();
 		}
 	}
+	REF_Tiles.Empty();
+	GeneratedGridSize=FIntVector::ZeroValue;
+	for(const auto& TempPair : REF_TileMeshes)
+	{
+		if(TempPair.Value)
+		{
+			TempPair.Value->DestroyComponent();
+		}
+	}
+	REF_TileMeshes.Empty();
+	REF_TileTypes.Empty();
+	REF_TileInstances.Empty();
+	REF_InstanceTiles.Empty();
 }
 
 void UOmegaGrid3D_Map::GenerateTiles()
 {
 	DestroyTiles();
-	if(!TileClass)
+	if(!TileClass && !bUseInstancedTiles)
 	{
 		return;
 	}
-	for (int ix = 0; ix < GridSize.X; ++ix)
+	GeneratedGridSize=FIntVector(FMath::Max(GridSize.X,0),FMath::Max(GridSize.Y,0),FMath::Max(GridSize.Z,0));
+	const int32 tile_count=GeneratedGridSize.X*GeneratedGridSize.Y*GeneratedGridSize.Z;
+	REF_Tiles.SetNumZeroed(tile_count);
+	if(bUseInstancedTiles)
+	{
+		local_GenerateInstancedTiles();
+	}
+	else
 	{
-		for (int iy = 0; iy < GridSize.Y; ++iy)
+		for(int32 tile_index=0; tile_index<tile_count; ++tile_index)
 		{
-			for (int iz = 0; iz < GridSize.Z; ++iz)
+			local_SpawnTileActor(GetCoordinateFromIndex(tile_index),DefaultTileType);
+		}
+	}
+	RefreshCostGrid();
+}
+
+AOmegaGrid3D_Tile* UOmegaGrid3D_Map::local_SpawnTileActor(FIntVector Coordinate, UOmegaGrid3DTileType* Type)
+{
+	AOmegaGrid3D_Tile* new_tile = GetWorld()->SpawnActorDeferred<AOmegaGrid3D_Tile>(TileClass,FTransform());
+	new_tile->AttachToActor(GetOwner(),FAttachmentTransformRules(EAttachmentRule::SnapToTarget,false));
+	new_tile->Owning_Gridmap=this;
+	new_tile->grid_coordinate=Coordinate;
+	if(!new_tile->TileType)
+	{
+		new_tile->TileType=Type;
+	}
+	FTransform newTransform=FTransform();
+	newTransform.SetLocation(GetVectorFromCoordinate(Coordinate));
+	newTransform.SetRotation(GetOwner()->GetActorRotation().Quaternion());
+	newTransform.SetScale3D(FVector(1,1,1));
+	new_tile->FinishSpawning(newTransform);
+	new_tile->AttachToActor(GetOwner(),FAttachmentTransformRules(EAttachmentRule::KeepWorld,false));
+	REF_Tiles[GetTileIndex(Coordinate)]=new_tile;
+	return new_tile;
+}
+
+void UOmegaGrid3D_Map::local_GenerateInstancedTiles()
+{
+	const int32 tile_count=REF_Tiles.Num();
+	REF_TileTypes.Init(DefaultTileType,tile_count);
+	REF_TileInstances.Init(INDEX_NONE,tile_count);
+
+	// Batch instances per tile type so each mesh component is filled with a single AddInstances call.
+	TMap<UOmegaGrid3DTileType*, TArray<int32>> tiles_by_type;
+	TArray<int32> promoted_tiles;
+	for(int32 tile_index=0; tile_index<tile_count; ++tile_index)
+	{
+		UOmegaGrid3DTileType* tile_type=REF_TileTypes[tile_index];
+		if(tile_type && tile_type->bSpawnAsActor)
+		{
+			promoted_tiles.Add(tile_index);
+		}
+		else
+		{
+			tiles_by_type.FindOrAdd(tile_type).Add(tile_index);
+		}
+	}
+	for(const auto& TempPair : tiles_by_type)
+	{
+		UInstancedStaticMeshComponent* tile_mesh=local_GetTileMesh(TempPair.Key);
+		if(!tile_mesh)
+		{
+			continue;
+		}
+		TArray<FTransform> instance_transforms;
+		instance_transforms.Reserve(TempPair.Value.Num());
+		for(const int32 tile_index : TempPair.Value)
+		{
+			instance_transforms.Add(local_GetTileTransform(GetCoordinateFromIndex(tile_index)));
+		}
+		const TArray<int32> instance_ids=tile_mesh->AddInstances(instance_transforms,true,true);
+		TArray<int32>& instance_tiles=REF_InstanceTiles.FindOrAdd(TempPair.Key);
+		instance_tiles.SetNum(tile_mesh->GetInstanceCount());
+		for(int32 i=0; i<instance_ids.Num(); ++i)
+		{
+			REF_TileInstances[TempPair.Value[i]]=instance_ids[i];
+			instance_tiles[instance_ids[i]]=TempPair.Value[i];
+		}
+	}
+	for(const int32 tile_index : promoted_tiles)
+	{
+		PromoteTileToActor(GetCoordinateFromIndex(tile_index));
+	}
+}
+
+UInstancedStaticMeshComponent* UOmegaGrid3D_Map::local_GetTileMesh(UOmegaGrid3DTileType* Type)
+{
+	if(!Type || !Type->TileMesh)
+	{
+		return nullptr;
+	}
+	if(UInstancedStaticMeshComponent* found_mesh=REF_TileMeshes.FindRef(Type))
+	{
+		return found_mesh;
+	}
+	UInstancedStaticMeshComponent* new_mesh=NewObject<UInstancedStaticMeshComponent>(GetOwner());
+	new_mesh->SetStaticMesh(Type->TileMesh);
+	new_mesh->SetupAttachment(this);
+	new_mesh->RegisterComponent();
+	REF_TileMeshes.Add(Type,new_mesh);
+	return new_mesh;
+}
+
+FTransform UOmegaGrid3D_Map::local_GetTileTransform(FIntVector Coordinate)
+{
+	return FTransform(GetOwner()->GetActorRotation().Quaternion(),GetVectorFromCoordinate(Coordinate),FVector(1,1,1));
+}
+
+void UOmegaGrid3D_Map::local_SetTileInstanceVisible(int32 TileIndex, bool bVisible)
+{
+	UOmegaGrid3DTileType* tile_type=REF_TileTypes[TileIndex];
+	if(!bVisible)
+	{
+		const int32 instance_id=REF_TileInstances[TileIndex];
+		UInstancedStaticMeshComponent* tile_mesh=REF_TileMeshes.FindRef(tile_type);
+		TArray<int32>* instance_tiles=REF_InstanceTiles.Find(tile_type);
+		if(tile_mesh && instance_tiles && instance_tiles->IsValidIndex(instance_id))
+		{
+			// Fill the slot with the last instance and remove the last one, so only that one tile's instance index changes.
+			const int32 last_id=instance_tiles->Num()-1;
+			if(instance_id!=last_id)
 			{
-				FIntVector new_coord = FIntVector(ix,iy,iz);
-				AOmegaGrid3D_Tile* new_tile = GetWorld()->SpawnActorDeferred<AOmegaGrid3D_Tile>(TileClass,FTransform());
-				new_tile->AttachToActor(GetOwner(),FAttachmentTransformRules(EAttachmentRule::SnapToTarget,false));
-				new_tile->Owning_Gridmap=this;
-				new_tile->grid_coordinate=new_coord;
-				FTransform newTransform=FTransform();
-				newTransform.SetLocation(GetVectorFromCoordinate(new_coord));
-				newTransform.SetRotation(GetOwner()->GetActorRotation().Quaternion());
-				newTransform.SetScale3D(FVector(1,1,1));
-				new_tile->FinishSpawning(newTransform);
-				new_tile->AttachToActor(GetOwner(),FAttachmentTransformRules(EAttachmentRule::KeepWorld,false));
-				REF_Tiles.AddUnique(new_tile);
+				const int32 moved_tile=(*instance_tiles)[last_id];
+				tile_mesh->UpdateInstanceTransform(instance_id,local_GetTileTransform(GetCoordinateFromIndex(moved_tile)),true,false);
+				(*instance_tiles)[instance_id]=moved_tile;
+				REF_TileInstances[moved_tile]=instance_id;
 			}
+			tile_mesh->RemoveInstance(last_id);
+			instance_tiles->Pop(EAllowShrinking::No);
+		}
+		REF_TileInstances[TileIndex]=INDEX_NONE;
+	}
+	else if(REF_TileInstances[TileIndex]==INDEX_NONE)
+	{
+		if(UInstancedStaticMeshComponent* tile_mesh=local_GetTileMesh(tile_type))
+		{
+			const int32 instance_id=tile_mesh->AddInstance(local_GetTileTransform(GetCoordinateFromIndex(TileIndex)),true);
+			TArray<int32>& instance_tiles=REF_InstanceTiles.FindOrAdd(tile_type);
+			instance_tiles.SetNum(FMath::Max(instance_tiles.Num(),instance_id+1));
+			instance_tiles[instance_id]=TileIndex;
+			REF_TileInstances[TileIndex]=instance_id;
 		}
 	}
 }
 
+AOmegaGrid3D_Tile* UOmegaGrid3D_Map::PromoteTileToActor(FIntVector Coordinate)
+{
+	const int32 tile_index=GetTileIndex(Coordinate);
+	if(!REF_Tiles.IsValidIndex(tile_index))
+	{
+		return nullptr;
+	}
+	if(REF_Tiles[tile_index])
+	{
+		return REF_Tiles[tile_index];
+	}
+	if(!TileClass || !REF_TileTypes.IsValidIndex(tile_index))
+	{
+		return nullptr;
+	}
+	local_SetTileInstanceVisible(tile_index,false);
+	AOmegaGrid3D_Tile* new_tile=local_SpawnTileActor(Coordinate,REF_TileTypes[tile_index]);
+	Native_UpdateCostAtIndex(tile_index);
+	return new_tile;
+}
+
+UOmegaGrid3DTileType* UOmegaGrid3D_Map::GetTileTypeAtCoordinate(FIntVector Coordinate)
+{
+	const int32 tile_index=GetTileIndex(Coordinate);
+	if(REF_Tiles.IsValidIndex(tile_index) && REF_Tiles[tile_index])
+	{
+		return REF_Tiles[tile_index]->GetTileType();
+	}
+	if(REF_TileTypes.IsValidIndex(tile_index))
+	{
+		return REF_TileTypes[tile_index];
+	}
+	return nullptr;
+}
+
+void UOmegaGrid3D_Map::SetTileTypeAtCoordinate(FIntVector Coordinate, UOmegaGrid3DTileType* Type)
+{
+	const int32 tile_index=GetTileIndex(Coordinate);
+	if(!Type || !REF_Tiles.IsValidIndex(tile_index))
+	{
+		return;
+	}
+	if(REF_Tiles[tile_index])
+	{
+		REF_Tiles[tile_index]->SetTileType(Type);
+		return;
+	}
+	if(REF_TileTypes.IsValidIndex(tile_index))
+	{
+		local_SetTileInstanceVisible(tile_index,false);
+		REF_TileTypes[tile_index]=Type;
+		if(Type->bSpawnAsActor)
+		{
+			PromoteTileToActor(Coordinate);
+		}
+		else
+		{
+			local_SetTileInstanceVisible(tile_index,true);
+		}
+		Native_UpdateCostAtIndex(tile_index);
+	}
+}
+
 TArray<AOmegaGrid3D_Tile*> UOmegaGrid3D_Map::GetTiles()
 {
-	return REF_Tiles;
+	TArray<AOmegaGrid3D_Tile*> out_tiles;
+	out_tiles.Reserve(REF_Tiles.Num());
+	for(auto* tempTile : REF_Tiles)
+	{
+		if(tempTile)
+		{
+			out_tiles.Add(tempTile);
+		}
+	}
+	return out_tiles;
 }
 
 FIntVector UOmegaGrid3D_Map::GetCoordinateFromVector(FVector Vector)
@@ -134,14 +586,176 @@ AOmegaGrid3D_Tile* UOmegaGrid3D_Map::GetTileFromVector(FVector Vector)
 
 AOmegaGrid3D_Tile* UOmegaGrid3D_Map::GetTileFromCoordinate(FIntVector Coordinate)
 {
-	for(auto* tempTile: GetTiles())
+	const int32 tile_index=GetTileIndex(Coordinate);
+	if(REF_Tiles.IsValidIndex(tile_index))
 	{
-		if(tempTile && tempTile->GetTileCoordinate()==Coordinate)
+		return REF_Tiles[tile_index];
+	}
+	return nullptr;
+}
+
+bool UOmegaGrid3D_Map::IsCoordinateInGrid(FIntVector Coordinate) const
+{
+	return Coordinate.X>=0 && Coordinate.Y>=0 && Coordinate.Z>=0
+		&& Coordinate.X<GeneratedGridSize.X && Coordinate.Y<GeneratedGridSize.Y && Coordinate.Z<GeneratedGridSize.Z;
+}
+
+int32 UOmegaGrid3D_Map::GetTileIndex(FIntVector Coordinate) const
+{
+	if(!IsCoordinateInGrid(Coordinate))
+	{
+		return INDEX_NONE;
+	}
+	return (Coordinate.X*GeneratedGridSize.Y+Coordinate.Y)*GeneratedGridSize.Z+Coordinate.Z;
+}
+
+FIntVector UOmegaGrid3D_Map::GetCoordinateFromIndex(int32 Index) const
+{
+	if(Index<0 || GeneratedGridSize.Y<=0 || GeneratedGridSize.Z<=0)
+	{
+		return FIntVector(INDEX_NONE);
+	}
+	return FIntVector(Index/(GeneratedGridSize.Y*GeneratedGridSize.Z),(Index/GeneratedGridSize.Z)%GeneratedGridSize.Y,Index%GeneratedGridSize.Z);
+}
+
+void UOmegaGrid3D_Map::RefreshCostGrid()
+{
+	CostGrid.Reset(GeneratedGridSize);
+	for(int32 tile_index=0; tile_index<REF_Tiles.Num(); ++tile_index)
+	{
+		Native_UpdateCostAtIndex(tile_index);
+	}
+}
+
+void UOmegaGrid3D_Map::Native_UpdateTileCost(AOmegaGrid3D_Tile* Tile)
+{
+	if(Tile)
+	{
+		Native_UpdateCostAtIndex(GetTileIndex(Tile->GetTileCoordinate()));
+	}
+}
+
+void UOmegaGrid3D_Map::Native_UpdateCostAtIndex(int32 TileIndex)
+{
+	if(!CostGrid.Costs.IsValidIndex(TileIndex) || !REF_Tiles.IsValidIndex(TileIndex))
+	{
+		return;
+	}
+	const AOmegaGrid3D_Tile* tile_actor=REF_Tiles[TileIndex];
+	if(!tile_actor && !REF_TileTypes.IsValidIndex(TileIndex))
+	{
+		return;
+	}
+	float tile_cost=1.0;
+	bool bBlocksLineOfEffect=false;
+	const UOmegaGrid3DTileType* tile_type = tile_actor ? tile_actor->GetTileType() : REF_TileTypes[TileIndex];
+	if(tile_type)
+	{
+		tile_cost = tile_type->bIsPassable ? tile_type->MovementCost : -1.0f;
+		bBlocksLineOfEffect=tile_type->bBlocksLineOfEffect;
+	}
+	CostGrid.Costs[TileIndex]=tile_cost;
+	CostGrid.BlocksLineOfEffect[TileIndex]=bBlocksLineOfEffect;
+	CostGrid.Occupied[TileIndex]=tile_actor && tile_actor->GetFirstOccupant()!=nullptr;
+	if(tile_cost>=0)
+	{
+		CostGrid.MinCost=FMath::Min(CostGrid.MinCost,tile_cost);
+	}
+}
+
+TArray<AOmegaGrid3D_Tile*> UOmegaGrid3D_Map::Native_GetTilesFromCoordinates(const TArray<FIntVector>& Coordinates)
+{
+	TArray<AOmegaGrid3D_Tile*> out_tiles;
+	out_tiles.Reserve(Coordinates.Num());
+	for(const FIntVector& TempCoord : Coordinates)
+	{
+		if(AOmegaGrid3D_Tile* found_tile = GetTileFromCoordinate(TempCoord))
 		{
-			return tempTile;
+			out_tiles.Add(found_tile);
 		}
 	}
-	return nullptr;
+	return out_tiles;
+}
+
+TArray<AOmegaGrid3D_Tile*> UOmegaGrid3D_Map::FindPath(AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* Goal, FOmegaGrid3D_PathParams Params, bool& bFound, float& PathCost)
+{
+	bFound=false;
+	PathCost=0;
+	TArray<FIntVector> path_coords;
+	if(Start && Goal && CostGrid.FindPath(Start->GetTileCoordinate(),Goal->GetTileCoordinate(),Params,path_coords,&PathCost))
+	{
+		bFound=true;
+		return Native_GetTilesFromCoordinates(path_coords);
+	}
+	return TArray<AOmegaGrid3D_Tile*>();
+}
+
+TArray<AOmegaGrid3D_Tile*> UOmegaGrid3D_Map::GetReachableTiles(AOmegaGrid3D_Tile* Origin, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	TArray<FIntVector> reachable_coords;
+	if(Origin)
+	{
+		CostGrid.GetReachable(Origin->GetTileCoordinate(),MaxCost,Params,reachable_coords);
+	}
+	return Native_GetTilesFromCoordinates(reachable_coords);
+}
+
+TArray<FOmegaGrid3D_TileList> UOmegaGrid3D_Map::GetReachableTilesBatch(TArray<AOmegaGrid3D_Tile*> Origins, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	TArray<FIntVector> start_coords;
+	for(auto* TempTile : Origins)
+	{
+		start_coords.Add(TempTile ? TempTile->GetTileCoordinate() : FIntVector(INDEX_NONE));
+	}
+	TArray<TArray<FIntVector>> reachable_coords;
+	CostGrid.GetReachableBatch(start_coords,MaxCost,Params,reachable_coords);
+
+	TArray<FOmegaGrid3D_TileList> out_lists;
+	out_lists.SetNum(reachable_coords.Num());
+	for(int32 i=0; i<reachable_coords.Num(); ++i)
+	{
+		out_lists[i].Tiles=Native_GetTilesFromCoordinates(reachable_coords[i]);
+	}
+	return out_lists;
+}
+
+bool UOmegaGrid3D_Map::HasLineOfEffect(AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* End)
+{
+	return Start && End && CostGrid.HasLineOfEffect(Start->GetTileCoordinate(),End->GetTileCoordinate());
+}
+
+TArray<FIntVector> UOmegaGrid3D_Map::FindPathCoordinates(FIntVector Start, FIntVector Goal, FOmegaGrid3D_PathParams Params, bool& bFound, float& PathCost)
+{
+	PathCost=0;
+	TArray<FIntVector> path_coords;
+	bFound=CostGrid.FindPath(Start,Goal,Params,path_coords,&PathCost);
+	return path_coords;
+}
+
+TArray<FIntVector> UOmegaGrid3D_Map::GetReachableCoordinates(FIntVector Origin, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	TArray<FIntVector> reachable_coords;
+	CostGrid.GetReachable(Origin,MaxCost,Params,reachable_coords);
+	return reachable_coords;
+}
+
+TArray<FOmegaGrid3D_CoordinateList> UOmegaGrid3D_Map::GetReachableCoordinatesBatch(TArray<FIntVector> Origins, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	TArray<TArray<FIntVector>> reachable_coords;
+	CostGrid.GetReachableBatch(Origins,MaxCost,Params,reachable_coords);
+
+	TArray<FOmegaGrid3D_CoordinateList> out_lists;
+	out_lists.SetNum(reachable_coords.Num());
+	for(int32 i=0; i<reachable_coords.Num(); ++i)
+	{
+		out_lists[i].Coordinates=MoveTemp(reachable_coords[i]);
+	}
+	return out_lists;
+}
+
+bool UOmegaGrid3D_Map::HasLineOfEffectBetweenCoordinates(FIntVector Start, FIntVector End)
+{
+	return CostGrid.HasLineOfEffect(Start,End);
 }
 
 
@@ -181,6 +795,20 @@ void UOmegaGrid3D_Occupant::SnapToNearestTile()
 	if(AActor* out_actor = UGameplayStatics::FindNearestActor(GetOwner()->GetActorLocation(),found_actors,DumpFloat))
 	{
 		SetTile(Cast<AOmegaGrid3D_Tile>(out_actor),true,true);
+		return;
+	}
+	// Instanced tiles have no actor to overlap, so promote the tile under the occupant instead.
+	for(auto* TempMap : GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>()->REF_Tilemaps)
+	{
+		if(TempMap && TempMap->bUseInstancedTiles)
+		{
+			const FIntVector snap_coord=TempMap->GetCoordinateFromVector(GetOwner()->GetActorLocation());
+			if(TempMap->IsCoordinateInGrid(snap_coord))
+			{
+				SetTile(TempMap->PromoteTileToActor(snap_coord),true,true);
+				return;
+			}
+		}
 	}
 }
 
@@ -192,20 +820,19 @@ void UOmegaGrid3D_Occupant::SetTile(AOmegaGrid3D_Tile* Tile, bool bClearPrevious
 	}
 }
 
+void UOmegaGrid3D_Occupant::SetTileAtCoordinate(UOmegaGrid3D_Map* Gridmap, FIntVector Coordinate, bool bClearPrevious, bool bSnap)
+{
+	if(Gridmap)
+	{
+		SetTile(Gridmap->PromoteTileToActor(Coordinate),bClearPrevious,bSnap);
+	}
+}
+
 AOmegaGrid3D_Tile* UOmegaGrid3D_Occupant::GetTile()
 {
-	for (auto* TempMap : GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>()->REF_Tilemaps)
+	if(const UOmegaSubsystem_Grid3D* grid_subsystem = GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>())
 	{
-		if (TempMap)
-		{
-			for(auto* TempTile : TempMap->GetTiles())
-			{
-				if(TempTile && TempTile->Occupants.Contains(this))
-				{
-					return TempTile;
-				}
-			}
-		}
+		return grid_subsystem->Native_GetOccupantTile(this);
 	}
 	return nullptr;
 }
@@ -287,6 +914,10 @@ void AOmegaGrid3D_Tile::SetTileType(UOmegaGrid3DTileType* Type)
 	if(Type)
 	{
 		TileType=Type;
+		if(Owning_Gridmap)
+		{
+			Owning_Gridmap->Native_UpdateTileCost(this);
+		}
 	}
 }
 
@@ -308,6 +939,11 @@ void AOmegaGrid3D_Tile::SetOccupantOnTile(UOmegaGrid3D_Occupant* Occupant, bool
 				Occupant->GetTile()->SetOccupantOnTile(Occupant,false,false,false);
 			}
 			Occupants.AddUnique(Occupant);
+			GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>()->Native_SetOccupantTile(Occupant,this,true);
+			if(Owning_Gridmap)
+			{
+				Owning_Gridmap->Native_UpdateTileCost(this);
+			}
 			if(bSnap)
 			{
 				Occupant->GetOwner()->SetActorLocation(GetActorLocation()+Occupant->TileOffset);
@@ -316,6 +952,11 @@ void AOmegaGrid3D_Tile::SetOccupantOnTile(UOmegaGrid3D_Occupant* Occupant, bool
 		if(!bIsOnTile && HasOccupant(Occupant))
 		{
 			Occupants.Remove(Occupant);
+			GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>()->Native_SetOccupantTile(Occupant,this,false);
+			if(Owning_Gridmap)
+			{
+				Owning_Gridmap->Native_UpdateTileCost(this);
+			}
 		}
 	}
 }
@@ -365,6 +1006,18 @@ FIntVector AOmegaGrid3D_Tile::GetTileCoordinate()
 	return  grid_coordinate;
 }
 
+void AOmegaGrid3D_Tile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(UOmegaSubsystem_Grid3D* grid_subsystem = GetWorld()->GetSubsystem<UOmegaSubsystem_Grid3D>())
+	{
+		for(auto* TempOccupant : Occupants)
+		{
+			grid_subsystem->Native_SetOccupantTile(TempOccupant,this,false);
+		}
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 void UOmegaSubsystem_Grid3D::Register_TileMap(UOmegaGrid3D_Map* Tilemap, bool bRegistered)
 {
 	if(Tilemap)
@@ -379,3 +1032,146 @@ void UOmegaSubsystem_Grid3D::Register_TileMap(UOmegaGrid3D_Map* Tilemap, bool bR
 		}
 	}
 }
+
+void UOmegaSubsystem_Grid3D::Native_SetOccupantTile(UOmegaGrid3D_Occupant* Occupant, AOmegaGrid3D_Tile* Tile, bool bIsOnTile)
+{
+	if(!Occupant)
+	{
+		return;
+	}
+	if(bIsOnTile && Tile)
+	{
+		REF_OccupantTiles.Add(Occupant,Tile);
+	}
+	else if(REF_OccupantTiles.FindRef(Occupant)==Tile)
+	{
+		REF_OccupantTiles.Remove(Occupant);
+	}
+}
+
+AOmegaGrid3D_Tile* UOmegaSubsystem_Grid3D::Native_GetOccupantTile(UOmegaGrid3D_Occupant* Occupant) const
+{
+	if(AOmegaGrid3D_Tile* const* found_tile = REF_OccupantTiles.Find(Occupant))
+	{
+		return *found_tile;
+	}
+	return nullptr;
+}
+
+// =====================================================================================================
+// Async Pathing
+// =====================================================================================================
+
+void UAsyncAction_Grid3DPathQuery::local_Finish(const TArray<FIntVector>& Coordinates, float Cost, bool bSuccess)
+{
+	if(bSuccess && local_Gridmap)
+	{
+		Success.Broadcast(local_bCoordinatesOnly ? TArray<AOmegaGrid3D_Tile*>() : local_Gridmap->Native_GetTilesFromCoordinates(Coordinates),Coordinates,Cost);
+	}
+	else
+	{
+		Failed.Broadcast(TArray<AOmegaGrid3D_Tile*>(),TArray<FIntVector>(),0);
+	}
+	SetReadyToDestroy();
+}
+
+void UAsyncAction_Grid3DPathQuery::Activate()
+{
+	if(local_Start)
+	{
+		local_StartCoord=local_Start->GetTileCoordinate();
+	}
+	if(local_Goal)
+	{
+		local_GoalCoord=local_Goal->GetTileCoordinate();
+	}
+	if(!local_Gridmap || !local_Gridmap->IsCoordinateInGrid(local_StartCoord) || (!local_bIsRangeQuery && !local_Gridmap->IsCoordinateInGrid(local_GoalCoord)))
+	{
+		local_Finish(TArray<FIntVector>(),0,false);
+		return;
+	}
+
+	// Snapshot everything the worker needs so the query never touches UObjects off the game thread.
+	const FOmegaGrid3D_CostGrid grid_snapshot=local_Gridmap->CostGrid;
+	const FIntVector start_coord=local_StartCoord;
+	const FIntVector goal_coord=local_GoalCoord;
+	const float max_cost=local_MaxCost;
+	const bool bIsRangeQuery=local_bIsRangeQuery;
+	const FOmegaGrid3D_PathParams params=local_Params;
+	TWeakObjectPtr<UAsyncAction_Grid3DPathQuery> weak_this(this);
+
+	Async(EAsyncExecution::ThreadPool,[grid_snapshot, start_coord, goal_coord, max_cost, bIsRangeQuery, params, weak_this]()
+	{
+		TArray<FIntVector> out_coords;
+		float out_cost=0;
+		bool bSuccess;
+		if(bIsRangeQuery)
+		{
+			grid_snapshot.GetReachable(start_coord,max_cost,params,out_coords);
+			bSuccess=!out_coords.IsEmpty();
+		}
+		else
+		{
+			bSuccess=grid_snapshot.FindPath(start_coord,goal_coord,params,out_coords,&out_cost);
+		}
+		AsyncTask(ENamedThreads::GameThread,[weak_this, out_coords=MoveTemp(out_coords), out_cost, bSuccess]()
+		{
+			if(UAsyncAction_Grid3DPathQuery* action=weak_this.Get())
+			{
+				action->local_Finish(out_coords,out_cost,bSuccess);
+			}
+		});
+	});
+}
+
+UAsyncAction_Grid3DPathQuery* UAsyncAction_Grid3DPathQuery::FindGrid3DPathAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap,
+	AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* Goal, FOmegaGrid3D_PathParams Params)
+{
+	UAsyncAction_Grid3DPathQuery* NewNode = NewObject<UAsyncAction_Grid3DPathQuery>();
+	NewNode->local_Gridmap=Gridmap;
+	NewNode->local_Start=Start;
+	NewNode->local_Goal=Goal;
+	NewNode->local_Params=Params;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
+
+UAsyncAction_Grid3DPathQuery* UAsyncAction_Grid3DPathQuery::GetGrid3DReachableTilesAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap,
+	AOmegaGrid3D_Tile* Origin, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	UAsyncAction_Grid3DPathQuery* NewNode = NewObject<UAsyncAction_Grid3DPathQuery>();
+	NewNode->local_Gridmap=Gridmap;
+	NewNode->local_Start=Origin;
+	NewNode->local_MaxCost=MaxCost;
+	NewNode->local_bIsRangeQuery=true;
+	NewNode->local_Params=Params;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
+
+UAsyncAction_Grid3DPathQuery* UAsyncAction_Grid3DPathQuery::FindGrid3DPathAsync_Coordinates(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap,
+	FIntVector Start, FIntVector Goal, FOmegaGrid3D_PathParams Params)
+{
+	UAsyncAction_Grid3DPathQuery* NewNode = NewObject<UAsyncAction_Grid3DPathQuery>();
+	NewNode->local_Gridmap=Gridmap;
+	NewNode->local_StartCoord=Start;
+	NewNode->local_GoalCoord=Goal;
+	NewNode->local_bCoordinatesOnly=true;
+	NewNode->local_Params=Params;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
+
+UAsyncAction_Grid3DPathQuery* UAsyncAction_Grid3DPathQuery::GetGrid3DReachableCoordinatesAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap,
+	FIntVector Origin, float MaxCost, FOmegaGrid3D_PathParams Params)
+{
+	UAsyncAction_Grid3DPathQuery* NewNode = NewObject<UAsyncAction_Grid3DPathQuery>();
+	NewNode->local_Gridmap=Gridmap;
+	NewNode->local_StartCoord=Origin;
+	NewNode->local_MaxCost=MaxCost;
+	NewNode->local_bIsRangeQuery=true;
+	NewNode->local_bCoordinatesOnly=true;
+	NewNode->local_Params=Params;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
@@ -2,13 +2,30 @@
 
 
 #include "Subsystems/OmegaSubsystem_Message.h"
+#include "OmegaSettings.h"
+
+void UOmegaMessageSubsystem::Initialize(FSubsystemCollectionBase& Colection)
+{
+	Super::Initialize(Colection);
+	MessageLog.SetCapacity(GetDefault<UOmegaSettings>()->MessageLogCapacity);
+}
+
+void UOmegaMessageSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UOmegaMessageSubsystem* This = CastChecked<UOmegaMessageSubsystem>(InThis);
+	for(FOmegaGameplayMessageData& TempData : This->MessageLog.GetStorage())
+	{
+		Collector.AddReferencedObject(TempData.Message, This);
+	}
+	Super::AddReferencedObjects(InThis, Collector);
+}
 
 void UOmegaMessageSubsystem::FireGameplayMessage(FOmegaGameplayMessageData Message)
 {
 	//Make and log message
 	FOmegaGameplayMessageData LoggedMessage = Message;
 	LoggedMessage.MessageLog_Text = Message.Message->GetMessageText();
-	MessageLog.Add(LoggedMessage);
+	MessageLog.Add(MoveTemp(LoggedMessage), Message.Message->GetMessageCategory());
 	
 	//Fire message delegate
 	OnGameplayMessage.Broadcast(Message.Message, Message.Message->GetMessageCategory(),Message.Message->GetValue_Implementation(""));
@@ -30,6 +47,26 @@ void UOmegaMessageSubsystem::FireCustomGameplayMessage(UObject* Instigator, FTex
 	FireGameplayMessage(LocalMessageData);
 }
 
+TArray<FText> UOmegaMessageSubsystem::GetMessageLogPage(FGameplayTag MessageCategory, int32 Start, int32 Count, int32& TotalEntries)
+{
+	TArray<FText> LocalTexts;
+	auto AddText = [&LocalTexts](const FOmegaGameplayMessageData& TempData)
+	{
+		LocalTexts.Add(TempData.MessageLog_Text);
+	};
+	if(MessageCategory.IsValid())
+	{
+		TotalEntries = MessageLog.NumOfKey(MessageCategory);
+		MessageLog.ForEachOfKeyInPage(MessageCategory, Start, Count, AddText);
+	}
+	else
+	{
+		TotalEntries = MessageLog.Num();
+		MessageLog.ForEachInPage(Start, Count, AddText);
+	}
+	return LocalTexts;
+}
+
 FLuaValue UOmegaGameplayMessage::GetValue_Implementation(const FString& Field) { return lua_val; }
 FLuaValue UOmegaGameplayMessage::GetKey_Implementation() { return lua_key; }
 void UOmegaGameplayMessage::SetKey_Implementation(FLuaValue Key) { lua_key=Key; }
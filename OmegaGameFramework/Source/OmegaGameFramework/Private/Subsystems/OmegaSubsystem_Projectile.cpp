@@ -0,0 +1,192 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+
+#include "Subsystems/OmegaSubsystem_Projectile.h"
+
+#include "OmegaGameFramework.h"
+#include "Components/SphereComponent.h"
+#include "Components/Component_Combatant.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Data Bullet Update"), STAT_OmegaDataBulletUpdate, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Data Bullets"), STAT_OmegaDataBullets, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Bullets Reused"), STAT_OmegaBulletPoolReuse, STATGROUP_Omega);
+
+
+void UOmegaProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaDataBulletUpdate);
+
+	UWorld* World = GetWorld();
+	if(!World)
+	{
+		return;
+	}
+
+	TArray<FOmegaDataBullet> LocalImpacts;
+	TArray<FHitResult> LocalHits;
+	TArray<FHitResult> SweepHits;
+
+	// Move every bullet first. Impacts are resolved afterwards, since effects and cues can spawn new bullets.
+	for(int32 i = DataBullets.Num()-1; i >= 0; i--)
+	{
+		FOmegaDataBullet& TempBullet = DataBullets[i];
+		TempBullet.RemainingLifetime -= DeltaTime;
+		TempBullet.Velocity.Z += TempBullet.GravityZ * DeltaTime;
+		const FVector NewLocation = TempBullet.Location + TempBullet.Velocity * DeltaTime;
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OmegaDataBullet), false);
+		if(IsValid(TempBullet.Instigator))
+		{
+			QueryParams.AddIgnoredActor(TempBullet.Instigator->GetOwner());
+		}
+
+		// Swept with the sphere's own channel and responses. Overlaps count as impacts, like the overlap event of bullet actors.
+		SweepHits.Reset();
+		if(TempBullet.bCollides)
+		{
+			World->SweepMultiByChannel(SweepHits, TempBullet.Location, NewLocation, FQuat::Identity, TempBullet.CollisionChannel,
+				FCollisionShape::MakeSphere(TempBullet.Radius), QueryParams, FCollisionResponseParams(TempBullet.CollisionResponses));
+		}
+		if(SweepHits.Num() > 0)
+		{
+			LocalHits.Add(SweepHits[0]);
+			LocalImpacts.Add(MoveTemp(TempBullet));
+			DataBullets.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		TempBullet.Location = NewLocation;
+		if(TempBullet.RemainingLifetime <= 0)
+		{
+			DataBullets.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+
+	for(int32 i = 0; i < LocalImpacts.Num(); i++)
+	{
+		const FOmegaDataBullet& TempBullet = LocalImpacts[i];
+		// Geometry without an actor (BSP, some landscapes) still plays the impact, with no target combatant.
+		AActor* HitActor = LocalHits[i].GetActor();
+		if(TempBullet.CueOnImpact)
+		{
+			UOmegaGameplayCueFunctions::PlayGameplayCue(this, TempBullet.CueOnImpact, FTransform(LocalHits[i].Location), LocalHits[i], nullptr);
+		}
+		UCombatantComponent* HitCombatant = HitActor ? HitActor->FindComponentByClass<UCombatantComponent>() : nullptr;
+		UCombatantComponent* LocalInstigator = IsValid(TempBullet.Instigator) ? TempBullet.Instigator : nullptr;
+		UOmegaScriptedEffectFunctions::ApplyCustomScriptedEffectToCombatant(TempBullet.ImpactEffects, HitCombatant, LocalInstigator);
+	}
+
+	SET_DWORD_STAT(STAT_OmegaDataBullets, DataBullets.Num());
+}
+
+void UOmegaProjectileSubsystem::Deinitialize()
+{
+	ClearDataBullets();
+	BulletPools.Empty();
+	Super::Deinitialize();
+}
+
+AOmegaBulletActor* UOmegaProjectileSubsystem::Native_AcquireBullet(TSubclassOf<AOmegaBulletActor> Bullet, const FTransform& Origin, const FOmegaCustomScriptedEffects& Effects, UCombatantComponent* Instigator)
+{
+	if(!Bullet)
+	{
+		return nullptr;
+	}
+
+	if(FOmegaBulletPool* Pool = BulletPools.Find(Bullet))
+	{
+		while(Pool->Actors.Num() > 0)
+		{
+			AOmegaBulletActor* TempBullet = Pool->Actors.Pop(EAllowShrinking::No);
+			if(IsValid(TempBullet))
+			{
+				TempBullet->InstigatorCombatant = Instigator;
+				TempBullet->ImpactEffects = Effects;
+				TempBullet->SetActorTransform(Origin, false, nullptr, ETeleportType::ResetPhysics);
+				TempBullet->Native_SetPooledActive(true);
+				INC_DWORD_STAT(STAT_OmegaBulletPoolReuse);
+				return TempBullet;
+			}
+		}
+	}
+
+	AOmegaBulletActor* NewBullet = GetWorld()->SpawnActorDeferred<AOmegaBulletActor>(Bullet, Origin, nullptr);
+	if(NewBullet)
+	{
+		NewBullet->InstigatorCombatant = Instigator;
+		NewBullet->ImpactEffects = Effects;
+		UGameplayStatics::FinishSpawningActor(NewBullet, Origin);
+	}
+	return NewBullet;
+}
+
+void UOmegaProjectileSubsystem::Native_ReleaseBullet(AOmegaBulletActor* Bullet)
+{
+	if(!IsValid(Bullet))
+	{
+		return;
+	}
+
+	FOmegaBulletPool& Pool = BulletPools.FindOrAdd(Bullet->GetClass());
+	if(Pool.Actors.Num() >= Bullet->MaxPooledBullets)
+	{
+		Bullet->Destroy();
+		return;
+	}
+	Bullet->Native_SetPooledActive(false);
+	Bullet->InstigatorCombatant = nullptr;
+	Bullet->ImpactEffects = FOmegaCustomScriptedEffects();
+	Pool.Actors.Add(Bullet);
+}
+
+void UOmegaProjectileSubsystem::Native_SpawnDataBullet(TSubclassOf<AOmegaBulletActor> Bullet, const FTransform& Origin, const FOmegaCustomScriptedEffects& Effects, UCombatantComponent* Instigator)
+{
+	if(!Bullet)
+	{
+		return;
+	}
+	const AOmegaBulletActor* DefaultBullet = GetDefault<AOmegaBulletActor>(Bullet);
+
+	FOmegaDataBullet NewBullet;
+	NewBullet.Location = Origin.GetLocation();
+	NewBullet.Velocity = Origin.GetRotation().GetForwardVector() * DefaultBullet->ProjectileComponent->InitialSpeed;
+	NewBullet.GravityZ = DefaultBullet->ProjectileComponent->ProjectileGravityScale * GetWorld()->GetGravityZ();
+	NewBullet.Radius = DefaultBullet->SphereComponent->GetUnscaledSphereRadius() * Origin.GetScale3D().GetAbsMax();
+	NewBullet.RemainingLifetime = DefaultBullet->DataBulletLifetime;
+	NewBullet.bCollides = DefaultBullet->SphereComponent->IsQueryCollisionEnabled();
+	NewBullet.CollisionChannel = DefaultBullet->SphereComponent->GetCollisionObjectType();
+	NewBullet.CollisionResponses = DefaultBullet->SphereComponent->GetCollisionResponseToChannels();
+	NewBullet.Instigator = Instigator;
+	NewBullet.CueOnImpact = DefaultBullet->CueOnImpact;
+	NewBullet.ImpactEffects = Effects;
+	DataBullets.Add(MoveTemp(NewBullet));
+
+	if(DefaultBullet->CueOnSpawn)
+	{
+		UOmegaGameplayCueFunctions::PlayGameplayCue(this, DefaultBullet->CueOnSpawn, Origin, FHitResult(), nullptr);
+	}
+}
+
+void UOmegaProjectileSubsystem::ClearDataBullets()
+{
+	DataBullets.Empty();
+	SET_DWORD_STAT(STAT_OmegaDataBullets, 0);
+}
+
+void UOmegaProjectileSubsystem::EmptyBulletPools()
+{
+	for(TPair<UClass*, FOmegaBulletPool>& TempPool : BulletPools)
+	{
+		for(AOmegaBulletActor* TempBullet : TempPool.Value.Actors)
+		{
+			if(IsValid(TempBullet))
+			{
+				TempBullet->Destroy();
+			}
+		}
+	}
+	BulletPools.Empty();
+}
@@ -6,53 +6,179 @@
 #include "GameplayTagContainer.h"
 
 
-bool UOmegaSubsystem_QueueDelay::IsTagInQueuedDelay(FGameplayTag Tag)
+void UOmegaSubsystem_QueueDelay::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddWeakLambda(this, [this]()
+	{
+		bMayHaveStaleSources = SourceDelayTags.Num() > 0;
+	});
+}
+
+void UOmegaSubsystem_QueueDelay::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	Super::Deinitialize();
+}
+
+void UOmegaSubsystem_QueueDelay::local_PollSources()
+{
+	if(PolledSources.IsEmpty())
+	{
+		return;
+	}
+	// Copied, as a source's state change may register or unregister sources.
+	const TArray<TWeakObjectPtr<UObject>> LocalSources = PolledSources;
+	for(const TWeakObjectPtr<UObject>& TempSource : LocalSources)
+	{
+		UpdateQueuedDelaySource(TempSource.Get());
+	}
+}
+
+void UOmegaSubsystem_QueueDelay::local_PurgeStaleSources()
 {
-	for (auto* TempObject : DelaySources)
+	if(!bMayHaveStaleSources)
 	{
-		if(TempObject &&
-			IInterface_QueueDelay::Execute_GetQueuedDelayTags(TempObject).HasTagExact(Tag) &&
-			IInterface_QueueDelay::Execute_GetQueuedDelayActive(TempObject))
+		return;
+	}
+	bMayHaveStaleSources = false;
+	DelaySources.RemoveAll([](const TWeakObjectPtr<UObject>& TempSource){ return !TempSource.IsValid(); });
+	PolledSources.RemoveAll([](const TWeakObjectPtr<UObject>& TempSource){ return !TempSource.IsValid(); });
+	TArray<TObjectKey<UObject>> StaleKeys;
+	for(const TPair<TObjectKey<UObject>, FGameplayTagContainer>& TempPair : SourceDelayTags)
+	{
+		if(!TempPair.Key.ResolveObjectPtr())
 		{
-			return true;
+			StaleKeys.Add(TempPair.Key);
 		}
 	}
-	return false;
+	for(const TObjectKey<UObject>& TempKey : StaleKeys)
+	{
+		local_SetSourceTags(TempKey, FGameplayTagContainer());
+		SourceDelayTags.Remove(TempKey);
+	}
 }
 
-bool UOmegaSubsystem_QueueDelay::SetQueuedDelaySourceRegistered(UObject* Source, bool bIsRegistered)
+void UOmegaSubsystem_QueueDelay::Tick(float DeltaTime)
+{
+	local_PurgeStaleSources();
+	local_PollSources();
+}
+
+bool UOmegaSubsystem_QueueDelay::IsTagInQueuedDelay(FGameplayTag Tag)
+{
+	local_PurgeStaleSources();
+	local_PollSources();
+	return DelayTagCounts.Contains(Tag);
+}
+
+bool UOmegaSubsystem_QueueDelay::SetQueuedDelaySourceRegistered(UObject* Source, bool bIsRegistered, bool bPushesState)
 {
 	if(bIsRegistered)
 	{
 		if(Source && Source->GetClass()->ImplementsInterface(UInterface_QueueDelay::StaticClass()))
 		{
 			DelaySources.AddUnique(Source);
+			if(bPushesState)
+			{
+				PolledSources.Remove(Source);
+			}
+			else
+			{
+				PolledSources.AddUnique(Source);
+			}
+			UpdateQueuedDelaySource(Source);
 			return true;
 		}	
 	}
 	else if(Source && DelaySources.Contains(Source))
 	{
+		local_SetSourceTags(Source, FGameplayTagContainer());
 		DelaySources.Remove(Source);
+		PolledSources.Remove(Source);
+		SourceDelayTags.Remove(Source);
 		return true;
 	}
 	return false;
 }
 
+void UOmegaSubsystem_QueueDelay::SetQueuedDelayTags(UObject* Source, FGameplayTagContainer ActiveTags)
+{
+	if(Source)
+	{
+		local_SetSourceTags(Source, ActiveTags);
+	}
+}
+
+void UOmegaSubsystem_QueueDelay::local_SetSourceTags(const TObjectKey<UObject>& SourceKey, const FGameplayTagContainer& ActiveTags)
+{
+	FGameplayTagContainer& LastTags = SourceDelayTags.FindOrAdd(SourceKey);
+	TArray<FGameplayTag> ReleasedTags;
+	for(const FGameplayTag& TempTag : LastTags)
+	{
+		if(!ActiveTags.HasTagExact(TempTag))
+		{
+			int32& TagCount = DelayTagCounts.FindOrAdd(TempTag);
+			if(--TagCount <= 0)
+			{
+				DelayTagCounts.Remove(TempTag);
+				ReleasedTags.Add(TempTag);
+			}
+		}
+	}
+	TArray<FGameplayTag> EnteredTags;
+	for(const FGameplayTag& TempTag : ActiveTags)
+	{
+		if(!LastTags.HasTagExact(TempTag))
+		{
+			int32& TagCount = DelayTagCounts.FindOrAdd(TempTag);
+			if(TagCount++ == 0)
+			{
+				EnteredTags.Add(TempTag);
+			}
+		}
+	}
+	LastTags = ActiveTags;
+
+	for(const FGameplayTag& TempTag : EnteredTags)
+	{
+		OnQueuedDelayChanged.Broadcast(TempTag, true);
+	}
+	for(const FGameplayTag& TempTag : ReleasedTags)
+	{
+		// Waiters may wait again from inside the broadcast, so they are moved out first.
+		FSimpleMulticastDelegate LocalWaiters;
+		DelayReleasedDelegates.RemoveAndCopyValue(TempTag, LocalWaiters);
+		LocalWaiters.Broadcast();
+		OnQueuedDelayChanged.Broadcast(TempTag, false);
+	}
+}
+
+void UOmegaSubsystem_QueueDelay::UpdateQueuedDelaySource(UObject* Source)
+{
+	if(Source && DelaySources.Contains(Source))
+	{
+		const bool bActive = IInterface_QueueDelay::Execute_GetQueuedDelayActive(Source);
+		local_SetSourceTags(Source, bActive ? IInterface_QueueDelay::Execute_GetQueuedDelayTags(Source) : FGameplayTagContainer());
+	}
+}
+
 void UAsyncAction_AwaitQueuedDelay::local_TryEnd()
 {
-	if(!local_WorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>()->IsTagInQueuedDelay(local_tag))
+	UOmegaSubsystem_QueueDelay* DelaySubsystem = local_WorldContext && local_WorldContext->GetWorld() ? local_WorldContext->GetWorld()->GetGameInstance()->GetSubsystem<UOmegaSubsystem_QueueDelay>() : nullptr;
+	if(local_finishing || !DelaySubsystem)
+	{
+		return;
+	}
+	if(!DelaySubsystem->IsTagInQueuedDelay(local_tag))
 	{
 		local_finishing=true;
 		Finished.Broadcast();
 		SetReadyToDestroy();
 	}
-}
-
-void UAsyncAction_AwaitQueuedDelay::Tick(float DeltaTime)
-{
-	if (!local_finishing && local_WorldContext)
+	else
 	{
-		local_TryEnd();
+		DelaySubsystem->Native_OnQueuedDelayReleased(local_tag).AddUObject(this, &UAsyncAction_AwaitQueuedDelay::local_TryEnd);
 	}
 }
 
@@ -68,5 +194,6 @@ UAsyncAction_AwaitQueuedDelay* UAsyncAction_AwaitQueuedDelay::AwaitQueuedDelay(U
 	UAsyncAction_AwaitQueuedDelay* NewNode = NewObject<UAsyncAction_AwaitQueuedDelay>();
 	NewNode->local_WorldContext=WorldContextObject;
 	NewNode->local_tag=QueueTag;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
 	return NewNode;
 }
@@ -6,10 +6,15 @@
 
 bool UOmegaSubsystem_QueuedQuery::CheckQueuedQuery(FGameplayTag Tag, UObject* Context)
 {
+	if(BlockedTagCounts.Contains(Tag))
+	{
+		return false;
+	}
+	
+	// Sources are only registered if they implement the interface.
 	for (auto* TempObject : QuerySources)
 	{
 		if(TempObject &&
-			TempObject->GetClass()->ImplementsInterface(UInterface_QueuedQuery::StaticClass()) &&
 			!IInterface_QueuedQuery::Execute_GetQueuedQueryValue(TempObject,Tag,Context) )
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Query returned false from %s"), *TempObject->GetName());
@@ -32,11 +37,53 @@ bool UOmegaSubsystem_QueuedQuery::SetQueuedQuerySourceRegistered(UObject* Source
 	else if(Source && QuerySources.Contains(Source))
 	{
 		QuerySources.Remove(Source);
+		SetQueuedQueryBlockedTags(Source, FGameplayTagContainer());
+		SourceBlockedTags.Remove(Source);
 		return true;
 	}
 	return false;
 }
 
+void UOmegaSubsystem_QueuedQuery::SetQueuedQueryBlockedTags(UObject* Source, FGameplayTagContainer BlockedTags)
+{
+	if(!Source)
+	{
+		return;
+	}
+	FGameplayTagContainer& LastTags = SourceBlockedTags.FindOrAdd(Source);
+	
+	TArray<FGameplayTag> ChangedTags;
+	for(const FGameplayTag& TempTag : LastTags)
+	{
+		if(!BlockedTags.HasTagExact(TempTag))
+		{
+			int32& TagCount = BlockedTagCounts.FindOrAdd(TempTag);
+			if(--TagCount <= 0)
+			{
+				BlockedTagCounts.Remove(TempTag);
+				ChangedTags.Add(TempTag);
+			}
+		}
+	}
+	for(const FGameplayTag& TempTag : BlockedTags)
+	{
+		if(!LastTags.HasTagExact(TempTag))
+		{
+			int32& TagCount = BlockedTagCounts.FindOrAdd(TempTag);
+			if(TagCount++ == 0)
+			{
+				ChangedTags.Add(TempTag);
+			}
+		}
+	}
+	LastTags = BlockedTags;
+
+	for(const FGameplayTag& TempTag : ChangedTags)
+	{
+		OnQueuedQueryBlockChanged.Broadcast(TempTag, BlockedTagCounts.Contains(TempTag));
+	}
+}
+
 bool UOmegaFunctions_QueueQuery::CheckQueuedQuery(UObject* WorldContextObject, FGameplayTag Tag, UObject* Context)
 {
 	if(WorldContextObject)
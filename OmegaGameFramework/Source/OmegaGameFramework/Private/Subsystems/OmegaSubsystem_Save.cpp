@@ -18,6 +18,172 @@
 #include "Misc/OmegaGameplayModule.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetRenderingLibrary.h"
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// ====================================================================================================
+// Save File
+// ====================================================================================================
+
+// Compressed game saves are written as a small header followed by the compressed save object bytes.
+// Uncompressed saves are written as the plain save object bytes, so other tools can still read them.
+static constexpr uint32 OmegaSaveFile_Magic = 0x47534D4F; // "OMSG"
+static constexpr uint8 OmegaSaveFile_Version = 1;
+
+static bool OmegaSaveFile_Write(const FString& SlotName, const TArray<uint8>& ObjectBytes, bool bCompress)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if(!SaveSystem || SlotName.IsEmpty() || ObjectBytes.IsEmpty())
+	{
+		return false;
+	}
+	
+	TArray<uint8> Payload;
+	if(bCompress)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, ObjectBytes.Num());
+		Payload.SetNumUninitialized(CompressedSize);
+		if(FCompression::CompressMemory(NAME_Zlib, Payload.GetData(), CompressedSize, ObjectBytes.GetData(), ObjectBytes.Num()))
+		{
+			Payload.SetNum(CompressedSize, EAllowShrinking::No);
+		}
+		else
+		{
+			bCompress = false;
+		}
+	}
+	if(!bCompress)
+	{
+		return SaveSystem->SaveGame(false, *SlotName, 0, ObjectBytes);
+	}
+
+	TArray<uint8> FileBytes;
+	FMemoryWriter Writer(FileBytes);
+	uint32 Magic = OmegaSaveFile_Magic;
+	uint8 Version = OmegaSaveFile_Version;
+	uint8 bIsCompressed = 1;
+	int32 UncompressedSize = ObjectBytes.Num();
+	Writer << Magic << Version << bIsCompressed << UncompressedSize;
+	Writer.Serialize(Payload.GetData(), Payload.Num());
+
+	return SaveSystem->SaveGame(false, *SlotName, 0, FileBytes);
+}
+
+// Slot headers live in their own small slot next to the save.
+static FString OmegaSaveFile_GetHeaderSlot(const FString& SlotName)
+{
+	return SlotName + TEXT("_header");
+}
+
+static constexpr uint8 OmegaSaveHeader_Version = 1;
+
+void FOmegaSaveSlotHeader::SerializeHeader(FArchive& Ar)
+{
+	uint8 Version = OmegaSaveHeader_Version;
+	Ar << Version;
+	// Unknown header versions are rejected, so the slot falls back to a full load.
+	if(Ar.IsLoading() && Version != OmegaSaveHeader_Version)
+	{
+		Ar.SetError();
+		return;
+	}
+	FSoftObjectPath ZonePath = ActiveZone.ToSoftObjectPath();
+	FString CategoryName = SaveCategory.ToString();
+	Ar << SlotName << DisplayName << Playtime << SaveDate << ZonePath << ActiveLevelName << CategoryName << ScreenshotPath;
+	if(Ar.IsLoading())
+	{
+		ActiveZone = TSoftObjectPtr<UOmegaZoneData>(ZonePath);
+		SaveCategory = FGameplayTag::RequestGameplayTag(FName(*CategoryName), false);
+	}
+}
+
+static TArray<uint8> OmegaSaveFile_MakeHeaderBytes(FOmegaSaveSlotHeader Header)
+{
+	TArray<uint8> HeaderBytes;
+	FMemoryWriter Writer(HeaderBytes);
+	Header.SerializeHeader(Writer);
+	return HeaderBytes;
+}
+
+// Writes the header slot of a save. A failed write deletes the old header, so readers fall back to the full save instead of a stale header.
+static bool OmegaSaveFile_WriteHeader(const FString& SlotName, const TArray<uint8>& HeaderBytes)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if(!SaveSystem)
+	{
+		return false;
+	}
+	const FString HeaderSlot = OmegaSaveFile_GetHeaderSlot(SlotName);
+	if(!HeaderBytes.IsEmpty() && SaveSystem->SaveGame(false, *HeaderSlot, 0, HeaderBytes))
+	{
+		return true;
+	}
+	UE_LOG(LogTemp, Warning, TEXT("Failed to write save header for slot %s"), *SlotName);
+	if(SaveSystem->DoesSaveGameExist(*HeaderSlot, 0))
+	{
+		SaveSystem->DeleteGame(false, *HeaderSlot, 0);
+	}
+	return false;
+}
+
+static bool OmegaSaveFile_ReadHeader(const FString& SlotName, FOmegaSaveSlotHeader& OutHeader)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	const FString HeaderSlot = OmegaSaveFile_GetHeaderSlot(SlotName);
+	TArray<uint8> HeaderBytes;
+	if(!SaveSystem || !SaveSystem->DoesSaveGameExist(*HeaderSlot, 0) || !SaveSystem->LoadGame(false, *HeaderSlot, 0, HeaderBytes))
+	{
+		return false;
+	}
+	FMemoryReader Reader(HeaderBytes);
+	OutHeader.SerializeHeader(Reader);
+	return !Reader.IsError();
+}
+
+// Reads the save object bytes of a slot. Files without the header are legacy saves and are returned as-is.
+static bool OmegaSaveFile_Read(const FString& SlotName, TArray<uint8>& OutObjectBytes)
+{
+	TArray<uint8> FileBytes;
+	if(!UGameplayStatics::LoadDataFromSlot(FileBytes, SlotName, 0))
+	{
+		return false;
+	}
+	
+	FMemoryReader Reader(FileBytes);
+	uint32 Magic = 0;
+	if(FileBytes.Num() >= sizeof(uint32))
+	{
+		Reader << Magic;
+	}
+	if(Magic != OmegaSaveFile_Magic)
+	{
+		OutObjectBytes = MoveTemp(FileBytes);
+		return true;
+	}
+	
+	uint8 Version = 0;
+	uint8 bIsCompressed = 0;
+	int32 UncompressedSize = 0;
+	Reader << Version << bIsCompressed << UncompressedSize;
+	if(Reader.IsError() || Version != OmegaSaveFile_Version || UncompressedSize <= 0)
+	{
+		return false;
+	}
+	const int64 BodyOffset = Reader.Tell();
+	const int32 BodySize = FileBytes.Num() - BodyOffset;
+	if(!bIsCompressed)
+	{
+		OutObjectBytes = TArray<uint8>(FileBytes.GetData() + BodyOffset, BodySize);
+		return true;
+	}
+	OutObjectBytes.SetNumUninitialized(UncompressedSize);
+	return FCompression::UncompressMemory(NAME_Zlib, OutObjectBytes.GetData(), UncompressedSize, FileBytes.GetData() + BodyOffset, BodySize);
+}
 
 // ====================================================================================================
 // Initialize
@@ -52,6 +218,7 @@ FString UOmegaSaveSubsystem::GetSavePlaytimeString(bool bGlobal, bool bIncludeMi
 
 void UOmegaSaveSubsystem::Deinitialize()
 {
+	FlushAsyncSaves();
 	SaveGlobalGame();
 }
 
@@ -79,14 +246,121 @@ TArray<UOmegaSaveGame*> UOmegaSaveSubsystem::GetSaveSlotList(int32 FirstIndex, i
 	for (int i = FirstIndex; i <= LastIndex; ++i)
 	{
 		bool bIsLoaded;
-		if(LoadGame(i, bIsLoaded))
+		if(UOmegaSaveGame* TempSave = LoadGame(i, bIsLoaded))
 		{
-			OutList.Add(LoadGame(i, bIsLoaded));
+			OutList.Add(TempSave);
 		}
 	}
 	return OutList;
 }
 
+TArray<FOmegaSaveSlotHeader> UOmegaSaveSubsystem::Native_ReadSaveSlotHeaders(const TArray<FString>& SlotNames, TArray<TArray<uint8>>& OutLegacySaves)
+{
+	// The platform save system is not safe to use from several threads at once, so slots are read serially.
+	TArray<FOmegaSaveSlotHeader> Headers;
+	Headers.SetNum(SlotNames.Num());
+	OutLegacySaves.SetNum(SlotNames.Num());
+	for(int32 i = 0; i < SlotNames.Num(); ++i)
+	{
+		if(!OmegaSaveFile_ReadHeader(SlotNames[i], Headers[i]))
+		{
+			Headers[i] = FOmegaSaveSlotHeader();
+			// Saves from before headers existed fall back to a full load.
+			if(UGameplayStatics::DoesSaveGameExist(SlotNames[i], 0) && !OmegaSaveFile_Read(SlotNames[i], OutLegacySaves[i]))
+			{
+				OutLegacySaves[i].Reset();
+			}
+		}
+	}
+	return Headers;
+}
+
+TArray<FOmegaSaveSlotHeader> UOmegaSaveSubsystem::Native_ResolveSaveSlotHeaders(const TArray<FString>& SlotNames, const TArray<FOmegaSaveSlotHeader>& ReadHeaders, const TArray<TArray<uint8>>& LegacySaves)
+{
+	TArray<FOmegaSaveSlotHeader> OutHeaders;
+	for(int32 i = 0; i < ReadHeaders.Num(); ++i)
+	{
+		if(!ReadHeaders[i].SlotName.IsEmpty())
+		{
+			OutHeaders.Add(ReadHeaders[i]);
+		}
+		else if(SlotNames.IsValidIndex(i) && LegacySaves.IsValidIndex(i) && !LegacySaves[i].IsEmpty())
+		{
+			if(UOmegaSaveGame* LegacySave = Cast<UOmegaSaveGame>(UGameplayStatics::LoadGameFromMemory(LegacySaves[i])))
+			{
+				OutHeaders.Add(local_MakeHeaderFromSave(SlotNames[i], LegacySave));
+			}
+		}
+	}
+	return OutHeaders;
+}
+
+TArray<FOmegaSaveSlotHeader> UOmegaSaveSubsystem::GetSaveSlotHeaders(int32 FirstIndex, int32 LastIndex)
+{
+	TArray<FString> SlotNames;
+	for (int i = FirstIndex; i <= LastIndex; ++i)
+	{
+		GetSaveSlotName(i, SlotNames.AddDefaulted_GetRef());
+	}
+	
+	TArray<TArray<uint8>> LegacySaves;
+	TArray<FOmegaSaveSlotHeader> ReadHeaders;
+	{
+		FScopeLock WriteLock(&SaveWriteQueue->WriteLock);
+		ReadHeaders = Native_ReadSaveSlotHeaders(SlotNames, LegacySaves);
+	}
+	return Native_ResolveSaveSlotHeaders(SlotNames, ReadHeaders, LegacySaves);
+}
+
+bool UOmegaSaveSubsystem::GetSaveSlotHeader_Named(FString Slot, FOmegaSaveSlotHeader& Header)
+{
+	FScopeLock WriteLock(&SaveWriteQueue->WriteLock);
+	if(OmegaSaveFile_ReadHeader(Slot, Header))
+	{
+		return true;
+	}
+	TArray<uint8> ObjectBytes;
+	if(OmegaSaveFile_Read(Slot, ObjectBytes))
+	{
+		if(UOmegaSaveGame* LegacySave = Cast<UOmegaSaveGame>(UGameplayStatics::LoadGameFromMemory(ObjectBytes)))
+		{
+			Header = local_MakeHeaderFromSave(Slot, LegacySave);
+			return true;
+		}
+	}
+	return false;
+}
+
+UTexture2D* UOmegaSaveSubsystem::GetSaveSlotScreenshot(const FOmegaSaveSlotHeader& Header)
+{
+	if(Header.SlotName.IsEmpty())
+	{
+		return nullptr;
+	}
+	if(UTexture2D** CachedScreenshot = REF_ScreenshotCache.Find(Header.SlotName))
+	{
+		return *CachedScreenshot;
+	}
+	const FString ScreenshotPath = Header.ScreenshotPath.IsEmpty() ? Local_GetScreenshotPath(Header.SlotName) : Header.ScreenshotPath;
+	UTexture2D* NewScreenshot = UKismetRenderingLibrary::ImportFileAsTexture2D(this, ScreenshotPath);
+	REF_ScreenshotCache.Add(Header.SlotName, NewScreenshot);
+	return NewScreenshot;
+}
+
+FOmegaSaveSlotHeader UOmegaSaveSubsystem::local_MakeHeaderFromSave(const FString& SlotName, UOmegaSaveGame* Save)
+{
+	FOmegaSaveSlotHeader NewHeader;
+	NewHeader.SlotName = SlotName;
+	NewHeader.DisplayName = Save->GetDisplayName();
+	NewHeader.Playtime = Save->Playtime;
+	NewHeader.SaveDate = Save->SaveDate;
+	NewHeader.ActiveZone = Save->ActiveZone;
+	NewHeader.ActiveLevelName = Save->ActiveLevelName;
+	NewHeader.SaveCategory = Save->SaveCategory;
+	NewHeader.ScreenshotPath = Local_GetScreenshotPath(SlotName);
+	return NewHeader;
+}
+
 UOmegaSaveGame* UOmegaSaveSubsystem::LoadGame(int32 Slot, bool& Success)
 {
 	FString SlotName;
@@ -101,8 +375,20 @@ UOmegaSaveGame* UOmegaSaveSubsystem::LoadGame_Named(FString Slot, bool& Success)
 	
 	if (ValidSave)
 	{
-		UOmegaSaveGame* LocalGameSave = Cast<UOmegaSaveGame>(UGameplayStatics::LoadGameFromSlot(Slot, 0));
-		LocalGameSave->SaveScreenshot = UKismetRenderingLibrary::ImportFileAsTexture2D(this, Local_GetScreenshotPath(Slot));
+		TArray<uint8> ObjectBytes;
+		UOmegaSaveGame* LocalGameSave = nullptr;
+		if(OmegaSaveFile_Read(Slot, ObjectBytes))
+		{
+			LocalGameSave = Cast<UOmegaSaveGame>(UGameplayStatics::LoadGameFromMemory(ObjectBytes));
+		}
+		if(!LocalGameSave)
+		{
+			Success = false;
+			return nullptr;
+		}
+		FOmegaSaveSlotHeader ScreenshotHeader;
+		ScreenshotHeader.SlotName = Slot;
+		LocalGameSave->SaveScreenshot = GetSaveSlotScreenshot(ScreenshotHeader);
 		return LocalGameSave;
 	}
 	
@@ -131,7 +417,7 @@ bool UOmegaSaveSubsystem::SaveGameUnique(EUniqueSaveFormats Format)
 
 
 
-bool UOmegaSaveSubsystem::Local_SaveGame(FString SlotName,FGameplayTag SaveCategory)
+FOmegaSaveSlotHeader UOmegaSaveSubsystem::local_SnapshotActiveGame(const FString& SlotName, FGameplayTag SaveCategory)
 {
 	//LocalActiveData->ActiveLevelName = UGameplayStatics::GetCurrentLevelName(this);
 
@@ -173,8 +459,157 @@ bool UOmegaSaveSubsystem::Local_SaveGame(FString SlotName,FGameplayTag SaveCateg
 
 	const FString fileName = Local_GetScreenshotPath(SlotName);
 	FScreenshotRequest::RequestScreenshot(fileName, false, false);
+	REF_ScreenshotCache.Remove(SlotName);
+
+	return local_MakeHeaderFromSave(SlotName, ActiveSaveData);
+}
+
+bool UOmegaSaveSubsystem::Local_SaveGame(FString SlotName,FGameplayTag SaveCategory)
+{
+	const FOmegaSaveSlotHeader Header = local_SnapshotActiveGame(SlotName, SaveCategory);
+
+	TArray<uint8> ObjectBytes;
+	if(!UGameplayStatics::SaveGameToMemory(ActiveSaveData, ObjectBytes))
+	{
+		return false;
+	}
+	// Let queued async saves land first so this one is always the newest write.
+	FlushAsyncSaves();
+	FScopeLock WriteLock(&SaveWriteQueue->WriteLock);
+	if(!OmegaSaveFile_Write(SlotName, ObjectBytes, GetMutableDefault<UOmegaSettings>()->bCompressSaveGames))
+	{
+		return false;
+	}
+	return OmegaSaveFile_WriteHeader(SlotName, OmegaSaveFile_MakeHeaderBytes(Header));
+}
+
+void UOmegaSaveSubsystem::SaveActiveGameAsync(int32 Slot, FGameplayTag SaveCategory)
+{
+	FString SlotName;
+	GetSaveSlotName(Slot, SlotName);
+	Native_SaveActiveGameAsync(SlotName, SaveCategory);
+}
+
+void UOmegaSaveSubsystem::SaveActiveGameAsync_Named(FString Slot, FGameplayTag SaveCategory)
+{
+	Native_SaveActiveGameAsync(Slot, SaveCategory);
+}
+
+void UOmegaSaveSubsystem::Native_SaveActiveGameAsync(const FString& SlotName, FGameplayTag SaveCategory, TFunction<void(bool)> OnComplete)
+{
+	const FOmegaSaveSlotHeader Header = local_SnapshotActiveGame(SlotName, SaveCategory);
+
+	// Serializing the save object touches UObjects, so it stays on the game thread. Compression and disk IO do not.
+	TArray<uint8> ObjectBytes;
+	if(!UGameplayStatics::SaveGameToMemory(ActiveSaveData, ObjectBytes))
+	{
+		if(OnComplete)
+		{
+			OnComplete(false);
+		}
+		OnAsyncSaveFinished.Broadcast(SlotName, false);
+		return;
+	}
+	local_EnqueueSaveWrite(SlotName, MoveTemp(ObjectBytes), OmegaSaveFile_MakeHeaderBytes(Header), MoveTemp(OnComplete));
+}
+
+void UOmegaSaveSubsystem::local_EnqueueSaveWrite(const FString& SlotName, TArray<uint8>&& Data, TArray<uint8>&& HeaderData, TFunction<void(bool)>&& OnComplete)
+{
+	FOmegaSaveWriteQueue& Queue = SaveWriteQueue.Get();
+	FScopeLock QueueLock(&Queue.QueueLock);
+
+	// A newer snapshot of a slot that is still waiting replaces the older one.
+	FOmegaSaveWriteQueue::FEntry* Entry = Queue.Entries.FindByPredicate([&SlotName](const FOmegaSaveWriteQueue::FEntry& TempEntry){ return !TempEntry.ReadJob && TempEntry.SlotName == SlotName; });
+	if(!Entry)
+	{
+		Entry = &Queue.Entries.AddDefaulted_GetRef();
+		Entry->SlotName = SlotName;
+	}
+	Entry->Data = MoveTemp(Data);
+	Entry->HeaderData = MoveTemp(HeaderData);
+	if(OnComplete)
+	{
+		Entry->Callbacks.Add(MoveTemp(OnComplete));
+	}
+	local_StartSaveWorker();
+}
+
+void UOmegaSaveSubsystem::Native_EnqueueSaveRead(TFunction<void()>&& Job)
+{
+	FOmegaSaveWriteQueue& Queue = SaveWriteQueue.Get();
+	FScopeLock QueueLock(&Queue.QueueLock);
+	Queue.Entries.AddDefaulted_GetRef().ReadJob = MoveTemp(Job);
+	local_StartSaveWorker();
+}
+
+void UOmegaSaveSubsystem::local_StartSaveWorker()
+{
+	FOmegaSaveWriteQueue& Queue = SaveWriteQueue.Get();
+	if(Queue.bWorkerRunning)
+	{
+		return;
+	}
+	Queue.bWorkerRunning = true;
 	
-	return UGameplayStatics::SaveGameToSlot(ActiveSaveData, SlotName, 0);
+	const bool bCompress = GetMutableDefault<UOmegaSettings>()->bCompressSaveGames;
+	TWeakObjectPtr<UOmegaSaveSubsystem> WeakThis(this);
+	Queue.Worker = Async(EAsyncExecution::ThreadPool, [QueuePtr = SaveWriteQueue, bCompress, WeakThis]()
+	{
+		for(;;)
+		{
+			FOmegaSaveWriteQueue::FEntry TempEntry;
+			{
+				FScopeLock QueueLock(&QueuePtr->QueueLock);
+				if(QueuePtr->Entries.IsEmpty())
+				{
+					QueuePtr->bWorkerRunning = false;
+					return;
+				}
+				TempEntry = MoveTemp(QueuePtr->Entries[0]);
+				QueuePtr->Entries.RemoveAt(0);
+			}
+
+			if(TempEntry.ReadJob)
+			{
+				FScopeLock WriteLock(&QueuePtr->WriteLock);
+				TempEntry.ReadJob();
+				continue;
+			}
+			
+			bool bSuccess;
+			{
+				FScopeLock WriteLock(&QueuePtr->WriteLock);
+				bSuccess = OmegaSaveFile_Write(TempEntry.SlotName, TempEntry.Data, bCompress)
+					&& OmegaSaveFile_WriteHeader(TempEntry.SlotName, TempEntry.HeaderData);
+			}
+			
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotName = MoveTemp(TempEntry.SlotName), Callbacks = MoveTemp(TempEntry.Callbacks), bSuccess]()
+			{
+				for(const TFunction<void(bool)>& TempCallback : Callbacks)
+				{
+					TempCallback(bSuccess);
+				}
+				if(WeakThis.IsValid())
+				{
+					WeakThis->OnAsyncSaveFinished.Broadcast(SlotName, bSuccess);
+				}
+			});
+		}
+	});
+}
+
+bool UOmegaSaveSubsystem::IsAsyncSaveInProgress() const
+{
+	FScopeLock QueueLock(&SaveWriteQueue->QueueLock);
+	return SaveWriteQueue->bWorkerRunning;
+}
+
+void UOmegaSaveSubsystem::FlushAsyncSaves()
+{
+	if(SaveWriteQueue->Worker.IsValid())
+	{
+		SaveWriteQueue->Worker.Wait();
+	}
 }
 
 
@@ -1014,3 +1449,101 @@ void UOmegaStoryStateScript::OnLevelChange_Implementation(UOmegaSaveSubsystem* S
 {
 }
 
+// ====================================================================================================
+// Async Save
+// ====================================================================================================
+
+void UAsyncAction_SaveActiveGame::Activate()
+{
+	if(!local_Subsystem)
+	{
+		Failed.Broadcast();
+		SetReadyToDestroy();
+		return;
+	}
+	TWeakObjectPtr<UAsyncAction_SaveActiveGame> WeakThis(this);
+	local_Subsystem->Native_SaveActiveGameAsync(local_SlotName, local_SaveCategory, [WeakThis](bool bSuccess)
+	{
+		if(UAsyncAction_SaveActiveGame* TempAction = WeakThis.Get())
+		{
+			if(bSuccess)
+			{
+				TempAction->Saved.Broadcast();
+			}
+			else
+			{
+				TempAction->Failed.Broadcast();
+			}
+			TempAction->SetReadyToDestroy();
+		}
+	});
+}
+
+UAsyncAction_SaveActiveGame* UAsyncAction_SaveActiveGame::SaveActiveGameAsync(UObject* WorldContextObject, int32 Slot, FGameplayTag SaveCategory)
+{
+	UAsyncAction_SaveActiveGame* NewNode = NewObject<UAsyncAction_SaveActiveGame>();
+	if(UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		NewNode->local_Subsystem = GameInstance->GetSubsystem<UOmegaSaveSubsystem>();
+		NewNode->local_Subsystem->GetSaveSlotName(Slot, NewNode->local_SlotName);
+	}
+	NewNode->local_SaveCategory = SaveCategory;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
+
+UAsyncAction_SaveActiveGame* UAsyncAction_SaveActiveGame::SaveActiveGameAsync_Named(UObject* WorldContextObject, FString Slot, FGameplayTag SaveCategory)
+{
+	UAsyncAction_SaveActiveGame* NewNode = NewObject<UAsyncAction_SaveActiveGame>();
+	if(UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		NewNode->local_Subsystem = GameInstance->GetSubsystem<UOmegaSaveSubsystem>();
+	}
+	NewNode->local_SlotName = Slot;
+	NewNode->local_SaveCategory = SaveCategory;
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
+
+void UAsyncAction_GetSaveSlotHeaders::Activate()
+{
+	UOmegaSaveSubsystem* SaveSubsystem = local_SaveSubsystem.Get();
+	if(!SaveSubsystem)
+	{
+		Loaded.Broadcast(TArray<FOmegaSaveSlotHeader>());
+		SetReadyToDestroy();
+		return;
+	}
+	// Read on the save worker so it never overlaps a write. Legacy saves are turned into headers back on the game thread.
+	TWeakObjectPtr<UAsyncAction_GetSaveSlotHeaders> WeakThis(this);
+	SaveSubsystem->Native_EnqueueSaveRead([SlotNames = local_SlotNames, WeakThis]()
+	{
+		TArray<TArray<uint8>> LegacySaves;
+		TArray<FOmegaSaveSlotHeader> ReadHeaders = UOmegaSaveSubsystem::Native_ReadSaveSlotHeaders(SlotNames, LegacySaves);
+		AsyncTask(ENamedThreads::GameThread, [SlotNames, ReadHeaders = MoveTemp(ReadHeaders), LegacySaves = MoveTemp(LegacySaves), WeakThis]()
+		{
+			if(UAsyncAction_GetSaveSlotHeaders* TempAction = WeakThis.Get())
+			{
+				UOmegaSaveSubsystem* LocalSubsystem = TempAction->local_SaveSubsystem.Get();
+				TempAction->Loaded.Broadcast(LocalSubsystem ? LocalSubsystem->Native_ResolveSaveSlotHeaders(SlotNames, ReadHeaders, LegacySaves) : TArray<FOmegaSaveSlotHeader>());
+				TempAction->SetReadyToDestroy();
+			}
+		});
+	});
+}
+
+UAsyncAction_GetSaveSlotHeaders* UAsyncAction_GetSaveSlotHeaders::GetSaveSlotHeadersAsync(UObject* WorldContextObject, int32 FirstIndex, int32 LastIndex)
+{
+	UAsyncAction_GetSaveSlotHeaders* NewNode = NewObject<UAsyncAction_GetSaveSlotHeaders>();
+	if(UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		UOmegaSaveSubsystem* SaveSubsystem = GameInstance->GetSubsystem<UOmegaSaveSubsystem>();
+		NewNode->local_SaveSubsystem = SaveSubsystem;
+		for (int i = FirstIndex; i <= LastIndex; ++i)
+		{
+			SaveSubsystem->GetSaveSlotName(i, NewNode->local_SlotNames.AddDefaulted_GetRef());
+		}
+	}
+	NewNode->RegisterWithGameInstance(WorldContextObject);
+	return NewNode;
+}
@@ -0,0 +1,151 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+
+#include "Subsystems/OmegaSubsystem_Tween.h"
+
+#include "OmegaGameFramework.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/App.h"
+
+DECLARE_CYCLE_STAT(TEXT("Tween Update"), STAT_OmegaTweenUpdate, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Tweens"), STAT_OmegaActiveTweens, STATGROUP_Omega);
+
+
+void UOmegaTweenSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaTweenUpdate);
+
+	// Real frame time, so pause and dilation are applied per tween.
+	const float RealDelta = FApp::GetDeltaTime();
+
+	bIsTicking = true;
+	for(int32 i = 0; i < Tweens.Num(); i++)
+	{
+		if(Tweens[i].bDone)
+		{
+			continue;
+		}
+		if(!Tweens[i].Owner.IsValid())
+		{
+			Tweens[i].bDone = true;
+			continue;
+		}
+
+		const UWorld* TweenWorld = Tweens[i].World.Get();
+		if(PausedGroups.Contains(Tweens[i].PauseGroup) || (!Tweens[i].bTickWhenPaused && TweenWorld && TweenWorld->IsPaused()))
+		{
+			continue;
+		}
+
+		if(Tweens[i].FinishCondition)
+		{
+			if(Tweens[i].FinishCondition())
+			{
+				Tweens[i].bDone = true;
+				if(Tweens[i].OnFinished)
+				{
+					Tweens[i].OnFinished();
+				}
+			}
+			continue;
+		}
+
+		float LocalDelta = RealDelta * Tweens[i].PlayRate;
+		if(Tweens[i].bUseTimeDilation && TweenWorld && TweenWorld->GetWorldSettings())
+		{
+			LocalDelta *= TweenWorld->GetWorldSettings()->GetEffectiveTimeDilation();
+		}
+		Tweens[i].Time += Tweens[i].bReversed ? -LocalDelta : LocalDelta;
+
+		const bool bShouldEnd = Tweens[i].bReversed ? Tweens[i].Time <= 0.f : (Tweens[i].EndTime >= 0.f && Tweens[i].Time >= Tweens[i].EndTime);
+		if(bShouldEnd)
+		{
+			Tweens[i].bDone = true;
+			if(Tweens[i].OnFinished)
+			{
+				Tweens[i].OnFinished();
+			}
+		}
+		else if(Tweens[i].OnUpdate)
+		{
+			const float Value = Tweens[i].Curve ? Tweens[i].Curve->GetFloatValue(Tweens[i].Time)
+				: (Tweens[i].EndTime > 0.f ? Tweens[i].Time / Tweens[i].EndTime : 1.f);
+			Tweens[i].OnUpdate(Value);
+		}
+	}
+	bIsTicking = false;
+
+	Tweens.RemoveAll([](const FOmegaTween& Tween) { return Tween.bDone; });
+	if(PendingTweens.Num() > 0)
+	{
+		Tweens.Append(MoveTemp(PendingTweens));
+		PendingTweens.Reset();
+	}
+
+	SET_DWORD_STAT(STAT_OmegaActiveTweens, Tweens.Num());
+}
+
+void UOmegaTweenSubsystem::Deinitialize()
+{
+	Tweens.Empty();
+	PendingTweens.Empty();
+	Super::Deinitialize();
+}
+
+int32 UOmegaTweenSubsystem::Native_AddTween(FOmegaTween&& Tween)
+{
+	Tween.Handle = NextTweenHandle++;
+	const int32 LocalHandle = Tween.Handle;
+	if(bIsTicking)
+	{
+		PendingTweens.Add(MoveTemp(Tween));
+	}
+	else
+	{
+		Tweens.Add(MoveTemp(Tween));
+	}
+	return LocalHandle;
+}
+
+int32 UOmegaTweenSubsystem::Native_WaitUntil(UObject* Owner, TFunction<bool()> Condition, TFunction<void()> OnFinished)
+{
+	FOmegaTween NewTween;
+	NewTween.EndTime = -1.f;
+	NewTween.bTickWhenPaused = true;
+	NewTween.Owner = Owner;
+	NewTween.World = Owner ? Owner->GetWorld() : nullptr;
+	NewTween.FinishCondition = MoveTemp(Condition);
+	NewTween.OnFinished = MoveTemp(OnFinished);
+	return Native_AddTween(MoveTemp(NewTween));
+}
+
+void UOmegaTweenSubsystem::Native_CancelTween(int32 Handle)
+{
+	if(Handle == INDEX_NONE)
+	{
+		return;
+	}
+	// Only flagged here, since this can be called from a tween callback. Done tweens are removed after the tick.
+	for(FOmegaTween& TempTween : Tweens)
+	{
+		if(TempTween.Handle == Handle)
+		{
+			TempTween.bDone = true;
+			return;
+		}
+	}
+	PendingTweens.RemoveAll([Handle](const FOmegaTween& Tween) { return Tween.Handle == Handle; });
+}
+
+void UOmegaTweenSubsystem::SetTweenGroupPaused(FName PauseGroup, bool bPaused)
+{
+	if(bPaused)
+	{
+		PausedGroups.Add(PauseGroup);
+	}
+	else
+	{
+		PausedGroups.Remove(PauseGroup);
+	}
+}
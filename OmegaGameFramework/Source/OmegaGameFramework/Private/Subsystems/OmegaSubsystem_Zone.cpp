@@ -25,6 +25,15 @@
 #include "Components/ArrowComponent.h"
 #include "Components/SceneCaptureComponent2D.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Engine/LevelStreaming.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "OmegaGameFramework.h"
+
+DECLARE_CYCLE_STAT(TEXT("Zone Stream Update"), STAT_OmegaZoneStreamUpdate, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Zone Streams In Flight"), STAT_OmegaZoneStreamsInFlight, STATGROUP_Omega);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Zone Prefetched Levels"), STAT_OmegaZonePrefetchedLevels, STATGROUP_Omega);
+DECLARE_MEMORY_STAT(TEXT("Zone Prefetch Size"), STAT_OmegaZonePrefetchSize, STATGROUP_Omega);
 
 
 UZoneEntityComponent::UZoneEntityComponent()
@@ -161,55 +170,31 @@ void UOmegaZoneSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UOmegaZoneSubsystem::Tick(float DeltaTime)
 {
+	if(bIsLoadTaskActive)
+	{
+		Local_OnNextLoadEvent();
+	}
+}
 
+FName UOmegaZoneSubsystem::GetLevelPackageName(const TSoftObjectPtr<UWorld>& SoftLevelReference)
+{
+	return FName(UWorld::RemovePIEPrefix(SoftLevelReference.GetLongPackageName()));
 }
 
 UOmegaLevelData* UOmegaZoneSubsystem::GetLevelData(TSoftObjectPtr<UWorld> SoftLevelReference)
 {
-
-	// Get the current level path
-	FString CurrentLevelPath = SoftLevelReference.GetLongPackageName();
-	UE_LOG(LogTemp, Warning, TEXT("LEVEL DATA CHECK --> CurrentLevelPath: %s"), *CurrentLevelPath);
-	// Remove ":PersistentLevel" from the level path
-	FString LevelPathWithoutPersistentLevel = CurrentLevelPath.Replace(TEXT(":PersistentLevel"), TEXT(""));
-	LevelPathWithoutPersistentLevel.ReplaceInline(TEXT("UEDPIE_0_"),TEXT(""));
-	
-	UE_LOG(LogTemp, Warning, TEXT("LEVEL DATA CHECK --> LevelPathWithoutPersistentLevel: %s"), *LevelPathWithoutPersistentLevel);
-	FString MainNameLevel;
-	FString MainNamePath;
-	
-	// Find the position of the first occurrence of "."
-	int32 DotIndex = -1;
-	if (LevelPathWithoutPersistentLevel.FindChar('/', DotIndex))
+	UOmegaZoneGameInstanceSubsystem* InstSubsys = GetWorld()->GetGameInstance()->GetSubsystem<UOmegaZoneGameInstanceSubsystem>();
+	if (!InstSubsys || SoftLevelReference.IsNull())
 	{
-		// Extract the level name from the path
-		LevelPathWithoutPersistentLevel.Split("/",&MainNamePath,&MainNameLevel,ESearchCase::IgnoreCase,ESearchDir::FromEnd);
-		
-		UE_LOG(LogTemp, Warning, TEXT("LEVEL DATA CHECK --> Final Level: %s"), *MainNameLevel);
-		UE_LOG(LogTemp, Warning, TEXT("LEVEL DATA CHECK --> Final Path: %s"), *MainNamePath);
-		// Construct the DataAsset path
-		FString DataAssetPath = LevelPathWithoutPersistentLevel +  TEXT("_WorldData.") + MainNameLevel + TEXT("_WorldData");
-		
-		// Print the DataAsset path to the log for debugging
-		UE_LOG(LogTemp, Warning, TEXT("LEVEL DATA CHECK --> DataAssetPath: %s"), *DataAssetPath);
-
-		// Load the DataAsset
-		UOmegaLevelData* OmegaLevelData = Cast<UOmegaLevelData>(StaticLoadObject(UOmegaLevelData::StaticClass(), nullptr, *DataAssetPath));
-
-		if (!OmegaLevelData)
-		{
-			// Handle the case when the DataAsset is not found.
-			UE_LOG(LogTemp, Warning, TEXT("OmegaLevelData '%s' not found!"), *DataAssetPath);
-		}
-
-		return OmegaLevelData;
+		return nullptr;
 	}
-	else
+	const FName LevelPackage = GetLevelPackageName(SoftLevelReference);
+	if (UOmegaLevelData* CachedData = InstSubsys->Native_FindLevelData(LevelPackage))
 	{
-		// Handle the case when "." is not found in the path.
-		UE_LOG(LogTemp, Warning, TEXT("Invalid level path: %s"), *CurrentLevelPath);
-		return nullptr;
+		return CachedData;
 	}
+	// Only reached if nothing requested this level's data ahead of time
+	return InstSubsys->Native_LoadLevelDataNow(LevelPackage);
 }
 
 UOmegaLevelData* UOmegaZoneSubsystem::GetCurrentLevelData()
@@ -344,14 +329,22 @@ void UOmegaZoneSubsystem::SpawnFromStartingPoint()
 
 void UOmegaZoneSubsystem::LoadDefaultZone()
 {
-	if(GetCurrentLevelData() && GetCurrentLevelData()->GetDefaultZoneData())  // Load Default Level Data
+	UOmegaZoneGameInstanceSubsystem* InstSubsys = GetWorld()->GetGameInstance()->GetSubsystem<UOmegaZoneGameInstanceSubsystem>();
+	if(LevelData || !InstSubsys)
 	{
-		LoadZone(GetCurrentLevelData()->GetDefaultZoneData());
+		LoadZone(LevelData && LevelData->GetDefaultZoneData() ? LevelData->GetDefaultZoneData() : FallbackZone);
+		return;
 	}
-	else
+	// Requested on world init, usually loaded by now. Otherwise wait for it rather than blocking.
+	TWeakObjectPtr<UOmegaZoneSubsystem> WeakThis(this);
+	InstSubsys->Native_RequestLevelData(GetLevelPackageName(GetCurrentLevelSoftReference()), [WeakThis](UOmegaLevelData* LoadedData)
 	{
-		LoadZone(FallbackZone);
-	}
+		if(UOmegaZoneSubsystem* ZoneSubsys = WeakThis.Get())
+		{
+			ZoneSubsys->LevelData = LoadedData;
+			ZoneSubsys->LoadZone(LoadedData && LoadedData->GetDefaultZoneData() ? LoadedData->GetDefaultZoneData() : ZoneSubsys->FallbackZone);
+		}
+	});
 }
 
 
@@ -365,6 +358,10 @@ void UOmegaZoneSubsystem::LoadZone(UOmegaZoneData* Zone, bool UnloadPreviousZone
 	}
 
 	UE_LOG(LogTemp, Display, TEXT("Begin Zone Load: %s"), *Zone->GetName());
+	ActiveTransitTrace = FOmegaZoneTransitTrace();
+	ActiveTransitTrace.Zone = Zone;
+	ActiveTransitTrace.StartTime = FPlatformTime::Seconds();
+	Local_TraceTransit(TEXT("Begin Transit"));
 	IncomingZone_Load = Zone;
 	bUnloadPreviousZones = UnloadPreviousZones;
 	IsMidPlayerTransit = true;
@@ -379,7 +376,7 @@ void UOmegaZoneSubsystem::UnloadZone(UOmegaZoneData* Zone)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Unloading Zone: %s"), *Zone->GetName());
 		IncomingZone_Unload = Zone;
-		Local_OnBeginLoadTaskList(IncomingZone_Unload->StreamedLevels, false);
+		Local_OnBeginLoadTaskList(IncomingZone_Unload, IncomingZone_Unload->StreamedLevels, false);
 	}
 }
 
@@ -418,6 +415,162 @@ AOmegaZonePoint* UOmegaZoneSubsystem::GetZonePointFromID(FGameplayTag ID)
 	return nullptr;
 }
 
+//#########################################################################################################
+// PREFETCH
+//#########################################################################################################
+
+void UOmegaZoneSubsystem::PrefetchZone(UOmegaZoneData* Zone, UObject* Source)
+{
+	const int64 Budget = int64(GetDefault<UOmegaSettings>()->ZonePrefetchBudgetMB) * 1024 * 1024;
+	if(!Zone || Budget <= 0 || IsZoneLoaded(Zone))
+	{
+		return;
+	}
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Highest priority levels get the budget first
+	TArray<FName> LocalLevels = Zone->StreamedLevels;
+	LocalLevels.StableSort([Zone](const FName& A, const FName& B)
+	{
+		return Zone->StreamedLevelPriorities.FindRef(A) > Zone->StreamedLevelPriorities.FindRef(B);
+	});
+	for(const FName& TempLevel : LocalLevels)
+	{
+		if(FOmegaZonePrefetchLevel* ExistingLevel = PrefetchedLevels.Find(TempLevel))
+		{
+			ExistingLevel->Sources.AddUnique(Source);
+			continue;
+		}
+		if(Local_IsLevelInLoadedZone(TempLevel))
+		{
+			continue;
+		}
+		ULevelStreaming* TempStreaming = UGameplayStatics::GetStreamingLevel(this, TempLevel);
+		if(!TempStreaming || TempStreaming->ShouldBeLoaded())
+		{
+			continue;
+		}
+		int64 LocalBytes = 0;
+		if(const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(TempStreaming->GetWorldAssetPackageFName()))
+		{
+			LocalBytes = FMath::Max<int64>(PackageData->DiskSize, 0);
+		}
+
+		// Make room by evicting the levels released longest ago
+		while(PrefetchedBytes + LocalBytes > Budget)
+		{
+			FName OldestLevel = NAME_None;
+			double OldestTime = TNumericLimits<double>::Max();
+			for(const TPair<FName, FOmegaZonePrefetchLevel>& TempPair : PrefetchedLevels)
+			{
+				if(TempPair.Value.Sources.IsEmpty() && TempPair.Value.ReleaseTime < OldestTime)
+				{
+					OldestLevel = TempPair.Key;
+					OldestTime = TempPair.Value.ReleaseTime;
+				}
+			}
+			if(OldestLevel.IsNone())
+			{
+				break;
+			}
+			Local_EvictPrefetchedLevel(OldestLevel);
+		}
+		if(PrefetchedBytes + LocalBytes > Budget)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Skipped Prefetch of Stream Level: %s (over budget)"), *TempLevel.ToString());
+			continue;
+		}
+
+		const int32 LocalPriority = Zone->StreamedLevelPriorities.FindRef(TempLevel);
+		TempStreaming->SetPriority(LocalPriority);
+		TempStreaming->bShouldBlockOnLoad = false;
+		TempStreaming->SetShouldBeLoaded(true);
+		TempStreaming->SetShouldBeVisible(false);
+
+		FOmegaZonePrefetchLevel& NewLevel = PrefetchedLevels.Add(TempLevel);
+		NewLevel.Streaming = TempStreaming;
+		NewLevel.Sources.Add(Source);
+		NewLevel.Bytes = LocalBytes;
+		PrefetchedBytes += LocalBytes;
+		UE_LOG(LogTemp, Display, TEXT("Prefetching Stream Level: %s"), *TempLevel.ToString());
+	}
+	SET_DWORD_STAT(STAT_OmegaZonePrefetchedLevels, PrefetchedLevels.Num());
+	SET_MEMORY_STAT(STAT_OmegaZonePrefetchSize, PrefetchedBytes);
+}
+
+void UOmegaZoneSubsystem::ReleaseZonePrefetch(UOmegaZoneData* Zone, UObject* Source)
+{
+	if(!Zone)
+	{
+		return;
+	}
+	for(const FName& TempLevel : Zone->StreamedLevels)
+	{
+		FOmegaZonePrefetchLevel* TempPrefetch = PrefetchedLevels.Find(TempLevel);
+		if(!TempPrefetch || TempPrefetch->Sources.Remove(Source) == 0 || !TempPrefetch->Sources.IsEmpty())
+		{
+			continue;
+		}
+		// Cancel loads still in progress. Loaded levels stay resident until the budget needs them.
+		if(!TempPrefetch->Streaming || !TempPrefetch->Streaming->IsLevelLoaded())
+		{
+			Local_EvictPrefetchedLevel(TempLevel);
+		}
+		else
+		{
+			TempPrefetch->ReleaseTime = FPlatformTime::Seconds();
+		}
+	}
+	SET_DWORD_STAT(STAT_OmegaZonePrefetchedLevels, PrefetchedLevels.Num());
+	SET_MEMORY_STAT(STAT_OmegaZonePrefetchSize, PrefetchedBytes);
+}
+
+bool UOmegaZoneSubsystem::Local_IsLevelInLoadedZone(FName Level) const
+{
+	for(const UOmegaZoneData* TempZone : LoadedZones)
+	{
+		if(TempZone && TempZone->StreamedLevels.Contains(Level))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UOmegaZoneSubsystem::Local_EvictPrefetchedLevel(FName Level)
+{
+	FOmegaZonePrefetchLevel TempPrefetch;
+	if(!PrefetchedLevels.RemoveAndCopyValue(Level, TempPrefetch))
+	{
+		return;
+	}
+	PrefetchedBytes -= TempPrefetch.Bytes;
+	// Leave levels that a zone has since made visible
+	if(TempPrefetch.Streaming && !TempPrefetch.Streaming->ShouldBeVisible() && !Local_IsLevelInLoadedZone(Level))
+	{
+		TempPrefetch.Streaming->SetShouldBeLoaded(false);
+		UE_LOG(LogTemp, Display, TEXT("Evicted Prefetched Stream Level: %s"), *Level.ToString());
+	}
+}
+
+void UOmegaZoneSubsystem::PrefetchLevelData(TSoftObjectPtr<UWorld> Level)
+{
+	UOmegaZoneGameInstanceSubsystem* InstSubsys = GetWorld()->GetGameInstance()->GetSubsystem<UOmegaZoneGameInstanceSubsystem>();
+	if(InstSubsys && !Level.IsNull())
+	{
+		InstSubsys->Native_RequestLevelData(GetLevelPackageName(Level));
+	}
+}
+
+void UOmegaZoneSubsystem::ReleaseLevelDataPrefetch(TSoftObjectPtr<UWorld> Level)
+{
+	UOmegaZoneGameInstanceSubsystem* InstSubsys = GetWorld()->GetGameInstance()->GetSubsystem<UOmegaZoneGameInstanceSubsystem>();
+	if(InstSubsys && !Level.IsNull())
+	{
+		InstSubsys->Native_CancelLevelDataRequest(GetLevelPackageName(Level));
+	}
+}
+
 //#########################################################################################################
 // TRANSIT
 //#########################################################################################################
@@ -451,6 +604,8 @@ void UOmegaZoneSubsystem::TransitPlayerToLevel_Name(FName Level, FGameplayTag Sp
 
 void UOmegaZoneSubsystem::TransitPlayerToLevel(TSoftObjectPtr<UWorld> Level, FGameplayTag SpawnID)
 {
+	PrefetchLevelData(Level);
+
 	const FString StartPath = Level.ToString();
 	FString EmptyPath;
 	FString targetLevel;
@@ -497,6 +652,7 @@ void UOmegaZoneSubsystem::Local_CompleteTransit()
 	}
 	IsMidPlayerTransit=false;
 	Local_IsWaitForLoad = false;
+	Local_FinishTransitTrace();
 }
 
 void UOmegaZoneSubsystem::Local_PreBeginTransitActions()
@@ -515,7 +671,7 @@ void UOmegaZoneSubsystem::Local_FinishZoneLoad()
 		LocalLevels = IncomingZone_Load->StreamedLevels;
 	}
 	
-	Local_OnBeginLoadTaskList(LocalLevels, true);
+	Local_OnBeginLoadTaskList(IncomingZone_Load, LocalLevels, true);
 }
 
 TSubclassOf<AOmegaGameplaySystem> UOmegaZoneSubsystem::GetZoneGameplaySystem()
@@ -527,46 +683,121 @@ TSubclassOf<AOmegaGameplaySystem> UOmegaZoneSubsystem::GetZoneGameplaySystem()
 	return nullptr;
 }
 
-void UOmegaZoneSubsystem::Local_OnBeginLoadTaskList(TArray<FName> Levels, bool Loaded)
+// Queues every level of the task. They are issued by priority, a bounded number at a time, and polled on tick.
+void UOmegaZoneSubsystem::Local_OnBeginLoadTaskList(UOmegaZoneData* Zone, TArray<FName> Levels, bool Loaded)
 {
-	Incoming_LoadList = Levels;
+	Incoming_LoadTaskZone = Zone;
 	Incoming_LoadState = Loaded;
+	Incoming_LoadQueue.Reset();
+	Incoming_InFlight.Reset();
+	for(const FName& TempLevel : Levels)
+	{
+		if(Loaded)
+		{
+			// Prefetched levels now belong to the zone
+			FOmegaZonePrefetchLevel TempPrefetch;
+			if(PrefetchedLevels.RemoveAndCopyValue(TempLevel, TempPrefetch))
+			{
+				PrefetchedBytes -= TempPrefetch.Bytes;
+			}
+		}
+		else if(Local_IsWaitForLoad && IncomingZone_Load && IncomingZone_Load->StreamedLevels.Contains(TempLevel))
+		{
+			// The incoming zone streams this level too, keep it
+			continue;
+		}
+		FOmegaZoneStreamRequest TempRequest;
+		TempRequest.Level = TempLevel;
+		if(Zone)
+		{
+			TempRequest.Priority = Zone->StreamedLevelPriorities.FindRef(TempLevel);
+		}
+		Incoming_LoadQueue.Add(TempRequest);
+	}
+	SET_DWORD_STAT(STAT_OmegaZonePrefetchedLevels, PrefetchedLevels.Num());
+	SET_MEMORY_STAT(STAT_OmegaZonePrefetchSize, PrefetchedBytes);
+	// Stable, so levels of equal priority keep the zone's order
+	Incoming_LoadQueue.StableSort([](const FOmegaZoneStreamRequest& A, const FOmegaZoneStreamRequest& B)
+	{
+		return A.Priority > B.Priority;
+	});
+	Local_TraceTransit(FString::Printf(TEXT("Begin %s Task (%d levels)"), Loaded ? TEXT("Load") : TEXT("Unload"), Levels.Num()));
+	bIsLoadTaskActive = true;
 	Local_OnNextLoadEvent();
-	
 }
 
-void UOmegaZoneSubsystem::Local_OnNextLoadEvent()
+bool UOmegaZoneSubsystem::Local_IsStreamRequestDone(const FOmegaZoneStreamRequest& Request) const
 {
-	FName Local_Name;
-	//End if List is empty
-	if(Incoming_LoadList.IsValidIndex(0))
+	if(!Request.Streaming)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("STARTING next level stream load/unload"));
-		Local_Name = Incoming_LoadList[0];
-		Incoming_LoadList.Remove(Local_Name);
+		return true;
 	}
-	else
+	const ELevelStreamingState LocalState = Request.Streaming->GetLevelStreamingState();
+	if(LocalState == ELevelStreamingState::FailedToLoad)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("COMPLETE Load/Unload Steam Events"));
-		Local_OnFinishLoadTask(Incoming_LoadState);
-		return;
+		return true;
 	}
-
-	// Setup Latant action
-	FLatentActionInfo Local_LatentLoad;
-	Local_LatentLoad.CallbackTarget = this;
-	Local_LatentLoad.ExecutionFunction = FName("Local_OnNextLoadEvent");
-	Local_LatentLoad.Linkage = 0;
-	
 	if(Incoming_LoadState)
 	{
-		UGameplayStatics::LoadStreamLevel(this, Local_Name, true, false, Local_LatentLoad);
-		UE_LOG(LogTemp, Warning, TEXT("Loading Steam Level: %s"), *Local_Name.ToString());
+		return LocalState == ELevelStreamingState::LoadedVisible;
 	}
-	else
+	return LocalState == ELevelStreamingState::Unloaded || LocalState == ELevelStreamingState::Removed;
+}
+
+void UOmegaZoneSubsystem::Local_OnNextLoadEvent()
+{
+	SCOPE_CYCLE_COUNTER(STAT_OmegaZoneStreamUpdate);
+
+	//Retire finished requests
+	for(int32 i = Incoming_InFlight.Num() - 1; i >= 0; i--)
+	{
+		if(Local_IsStreamRequestDone(Incoming_InFlight[i]))
+		{
+			const FOmegaZoneStreamRequest& TempRequest = Incoming_InFlight[i];
+			UE_LOG(LogTemp, Display, TEXT("%s Stream Level: %s (%.3fs)"), Incoming_LoadState ? TEXT("Loaded") : TEXT("Unloaded"), *TempRequest.Level.ToString(), FPlatformTime::Seconds() - TempRequest.RequestTime);
+			Local_TraceTransit(FString::Printf(TEXT("%s: %s"), Incoming_LoadState ? TEXT("Loaded") : TEXT("Unloaded"), *TempRequest.Level.ToString()));
+			Incoming_InFlight.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+
+	//Issue queued requests up to the in-flight limit
+	const int32 MaxInFlight = FMath::Max(GetDefault<UOmegaSettings>()->MaxConcurrentZoneStreams, 1);
+	while(Incoming_InFlight.Num() < MaxInFlight && !Incoming_LoadQueue.IsEmpty())
+	{
+		FOmegaZoneStreamRequest TempRequest = Incoming_LoadQueue[0];
+		Incoming_LoadQueue.RemoveAt(0, 1, EAllowShrinking::No);
+		TempRequest.RequestTime = FPlatformTime::Seconds();
+		TempRequest.Streaming = UGameplayStatics::GetStreamingLevel(this, TempRequest.Level);
+		if(!TempRequest.Streaming)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No Stream Level found: %s"), *TempRequest.Level.ToString());
+			continue;
+		}
+		if(Incoming_LoadState)
+		{
+			TempRequest.Streaming->SetPriority(TempRequest.Priority);
+			TempRequest.Streaming->bShouldBlockOnLoad = false;
+			TempRequest.Streaming->SetShouldBeLoaded(true);
+			TempRequest.Streaming->SetShouldBeVisible(true);
+			UE_LOG(LogTemp, Display, TEXT("Loading Stream Level: %s (Priority %d)"), *TempRequest.Level.ToString(), TempRequest.Priority);
+		}
+		else
+		{
+			TempRequest.Streaming->bShouldBlockOnUnload = true;
+			TempRequest.Streaming->SetShouldBeLoaded(false);
+			TempRequest.Streaming->SetShouldBeVisible(false);
+			UE_LOG(LogTemp, Display, TEXT("Unloading Stream Level: %s"), *TempRequest.Level.ToString());
+		}
+		Incoming_InFlight.Add(TempRequest);
+	}
+	SET_DWORD_STAT(STAT_OmegaZoneStreamsInFlight, Incoming_InFlight.Num());
+
+	//All requests finished, report once
+	if(Incoming_InFlight.IsEmpty() && Incoming_LoadQueue.IsEmpty())
 	{
-		UGameplayStatics::UnloadStreamLevel(this, Local_Name, Local_LatentLoad, true);
-		UE_LOG(LogTemp, Warning, TEXT("Unloading Steam Level: %s"), *Local_Name.ToString());
+		UE_LOG(LogTemp, Display, TEXT("COMPLETE Load/Unload Stream Events"));
+		bIsLoadTaskActive = false;
+		Local_OnFinishLoadTask(Incoming_LoadState);
 	}
 }
 
@@ -576,6 +807,7 @@ void UOmegaZoneSubsystem::Local_OnFinishLoadTask(bool LoadState)
 	if (LoadState)
 	{
 		UE_LOG(LogTemp, Display, TEXT("Finish Zone LOAD"));
+		Local_TraceTransit(TEXT("Zone Loaded"));
 
 		if (Incoming_LoadTaskZone)
 		{
@@ -607,6 +839,7 @@ void UOmegaZoneSubsystem::Local_OnFinishLoadTask(bool LoadState)
 	else
 	{
 		UE_LOG(LogTemp, Display, TEXT("Finish Zone UNLOAD"));
+		Local_TraceTransit(TEXT("Zone Unloaded"));
 
 		LoadedZones.Remove(IncomingZone_Unload);
 		OnZoneUnloaded.Broadcast(IncomingZone_Unload);
@@ -626,6 +859,35 @@ void UOmegaZoneSubsystem::Local_OnFinishLoadTask(bool LoadState)
 	}
 }
 
+void UOmegaZoneSubsystem::Local_TraceTransit(const FString& Label)
+{
+	if(ActiveTransitTrace.StartTime <= 0.0)
+	{
+		return;
+	}
+	FOmegaZoneTraceEvent TempEvent;
+	TempEvent.Label = Label;
+	TempEvent.Time = FPlatformTime::Seconds() - ActiveTransitTrace.StartTime;
+	ActiveTransitTrace.Events.Add(TempEvent);
+}
+
+void UOmegaZoneSubsystem::Local_FinishTransitTrace()
+{
+	if(ActiveTransitTrace.StartTime <= 0.0)
+	{
+		return;
+	}
+	Local_TraceTransit(TEXT("Transit Complete"));
+	ActiveTransitTrace.TotalTime = FPlatformTime::Seconds() - ActiveTransitTrace.StartTime;
+	UE_LOG(LogTemp, Display, TEXT("Zone Transit Trace: %s (%.3fs)"), ActiveTransitTrace.Zone ? *ActiveTransitTrace.Zone->GetName() : TEXT("None"), ActiveTransitTrace.TotalTime);
+	for(const FOmegaZoneTraceEvent& TempEvent : ActiveTransitTrace.Events)
+	{
+		UE_LOG(LogTemp, Display, TEXT("    %8.3fs  %s"), TempEvent.Time, *TempEvent.Label);
+	}
+	LastTransitTrace = ActiveTransitTrace;
+	ActiveTransitTrace = FOmegaZoneTransitTrace();
+}
+
 //#########################################################################################################
 // TRANSIT Animation
 //#########################################################################################################
@@ -699,6 +961,7 @@ void UOmegaZoneSubsystem::Local_OnFinishTransitSequence()
 		if(bSequenceTransit_IsForward)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Sequence Finished: Fade Out"));
+			Local_TraceTransit(TEXT("Fade Out Finished"));
 			//SEQUENCE FINISHED: Fade Out 
 			if(GetTopLoadedZones() && bUnloadPreviousZones)
 			{
@@ -823,6 +1086,7 @@ void AOmegaZoneTransit::BeginPlay()
 
 void AOmegaZoneTransit::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	SetPrefetchActive(false);
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -927,11 +1191,70 @@ void AOmegaZoneTransit::OnBoxNotifyOverlapBegin(UPrimitiveComponent* OverlappedC
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
 	GetWorld()->GetSubsystem<UOmegaZoneSubsystem>()->OnZoneTransitInRange.Broadcast(this,true);
+	if(bPrefetchOnNotify && IsPlayerPawn(OtherActor) && CanPlayerTransit(Cast<APawn>(OtherActor)))
+	{
+		SetPrefetchActive(true);
+	}
 }
 
 void AOmegaZoneTransit::OnBoxNotifyOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
 {
 	GetWorld()->GetSubsystem<UOmegaZoneSubsystem>()->OnZoneTransitInRange.Broadcast(this,false);
+	if(IsPlayerPawn(OtherActor))
+	{
+		SetPrefetchActive(false);
+	}
+}
+
+UOmegaZoneData* AOmegaZoneTransit::GetDestinationZone() const
+{
+	if(bTransitToLevel)
+	{
+		return nullptr;
+	}
+	const AOmegaZonePoint* incoming_point=TransitPoint;
+	if(TransitPoint_Linked && TransitPoint_Linked->linked_point)
+	{
+		incoming_point=TransitPoint_Linked->linked_point;
+	}
+	return incoming_point ? incoming_point->ZoneToLoad : nullptr;
+}
+
+bool AOmegaZoneTransit::IsPlayerPawn(AActor* Actor) const
+{
+	const APawn* LocalPawn = Cast<APawn>(Actor);
+	return LocalPawn && LocalPawn->IsPlayerControlled();
+}
+
+void AOmegaZoneTransit::SetPrefetchActive(bool bActive)
+{
+	if(!SubsysRef)
+	{
+		return;
+	}
+	if(bTransitToLevel)
+	{
+		if(bActive)
+		{
+			SubsysRef->PrefetchLevelData(TransitLevel);
+		}
+		else if(!SubsysRef->bIsInLevelTransit)
+		{
+			// Kept during a level transit, the next level picks it up
+			SubsysRef->ReleaseLevelDataPrefetch(TransitLevel);
+		}
+		return;
+	}
+	if(PrefetchedZone)
+	{
+		SubsysRef->ReleaseZonePrefetch(PrefetchedZone, this);
+		PrefetchedZone = nullptr;
+	}
+	if(bActive)
+	{
+		PrefetchedZone = GetDestinationZone();
+		SubsysRef->PrefetchZone(PrefetchedZone, this);
+	}
 }
 
 
@@ -1000,6 +1323,12 @@ void UOmegaZoneGameInstanceSubsystem::Deinitialize()
 
 void UOmegaZoneGameInstanceSubsystem::OnLevelChanged(UWorld* World, const UWorld::InitializationValues)
 {
+	// Start loading the new level's data before anything asks for it
+	if(World && World->IsGameWorld())
+	{
+		Native_RequestLevelData(FName(UWorld::RemovePIEPrefix(World->GetOutermost()->GetName())));
+	}
+
 	if(IsInlevelTransit)
 	{
 		//IsInlevelTransit=false;
@@ -1007,6 +1336,141 @@ void UOmegaZoneGameInstanceSubsystem::OnLevelChanged(UWorld* World, const UWorld
 	}
 }
 
+void UOmegaZoneGameInstanceSubsystem::Local_BuildLevelDataPaths()
+{
+	bLevelDataPathsBuilt = true;
+	LevelDataPaths.Reset();
+
+	// Level data assets are named <Level>_WorldData and sit next to their level
+	static const FString WorldDataSuffix = TEXT("_WorldData");
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> LocalAssets;
+	AssetRegistry.GetAssetsByClass(UOmegaLevelData::StaticClass()->GetClassPathName(), LocalAssets, true);
+	for(const FAssetData& TempAsset : LocalAssets)
+	{
+		FString LocalPackage = TempAsset.PackageName.ToString();
+		if(LocalPackage.RemoveFromEnd(WorldDataSuffix))
+		{
+			LevelDataPaths.Add(FName(LocalPackage), TempAsset.GetSoftObjectPath());
+		}
+	}
+}
+
+FSoftObjectPath UOmegaZoneGameInstanceSubsystem::GetLevelDataAssetPath(FName LevelPackage)
+{
+	if(!bLevelDataPathsBuilt)
+	{
+		Local_BuildLevelDataPaths();
+	}
+	if(const FSoftObjectPath* FoundPath = LevelDataPaths.Find(LevelPackage))
+	{
+		return *FoundPath;
+	}
+	// Not in the registry (still scanning in editor). Use the naming convention and remember it.
+	const FString LocalPackage = LevelPackage.ToString();
+	FString LocalLevelName = FPackageName::GetShortName(LocalPackage);
+	if(LocalPackage.IsEmpty() || LocalLevelName.IsEmpty())
+	{
+		return FSoftObjectPath();
+	}
+	const FSoftObjectPath ConventionPath(LocalPackage + TEXT("_WorldData.") + LocalLevelName + TEXT("_WorldData"));
+	LevelDataPaths.Add(LevelPackage, ConventionPath);
+	return ConventionPath;
+}
+
+void UOmegaZoneGameInstanceSubsystem::Native_RequestLevelData(FName LevelPackage, TFunction<void(UOmegaLevelData*)>&& OnLoaded)
+{
+	if(LevelPackage.IsNone())
+	{
+		if(OnLoaded) { OnLoaded(nullptr); }
+		return;
+	}
+	// Already resolved, including levels known to have no data
+	if(UOmegaLevelData** CachedData = LevelDataCache.Find(LevelPackage))
+	{
+		if(OnLoaded) { OnLoaded(*CachedData); }
+		return;
+	}
+	if(OnLoaded)
+	{
+		PendingLevelDataCallbacks.FindOrAdd(LevelPackage).Add(MoveTemp(OnLoaded));
+	}
+	if(PendingLevelData.Contains(LevelPackage))
+	{
+		return;
+	}
+	const FSoftObjectPath AssetPath = GetLevelDataAssetPath(LevelPackage);
+	if(AssetPath.IsNull())
+	{
+		Local_OnLevelDataLoaded(LevelPackage);
+		return;
+	}
+	TSharedPtr<FStreamableHandle> LocalHandle = StreamableManager.RequestAsyncLoad(AssetPath,
+		FStreamableDelegate::CreateWeakLambda(this, [this, LevelPackage]()
+		{
+			Local_OnLevelDataLoaded(LevelPackage);
+		}), FStreamableManager::AsyncLoadHighPriority);
+	// The delegate may already have run if the asset was in memory
+	if(LocalHandle.IsValid() && !LevelDataCache.Contains(LevelPackage))
+	{
+		PendingLevelData.Add(LevelPackage, LocalHandle);
+	}
+}
+
+void UOmegaZoneGameInstanceSubsystem::Native_CancelLevelDataRequest(FName LevelPackage)
+{
+	// Keep loads someone is waiting on
+	if(PendingLevelDataCallbacks.Contains(LevelPackage))
+	{
+		return;
+	}
+	TSharedPtr<FStreamableHandle> LocalHandle;
+	if(PendingLevelData.RemoveAndCopyValue(LevelPackage, LocalHandle) && LocalHandle.IsValid())
+	{
+		LocalHandle->CancelHandle();
+	}
+}
+
+UOmegaLevelData* UOmegaZoneGameInstanceSubsystem::Native_LoadLevelDataNow(FName LevelPackage)
+{
+	if(UOmegaLevelData** CachedData = LevelDataCache.Find(LevelPackage))
+	{
+		return *CachedData;
+	}
+	const FSoftObjectPath AssetPath = GetLevelDataAssetPath(LevelPackage);
+	if(!AssetPath.IsNull())
+	{
+		StreamableManager.LoadSynchronous(AssetPath);
+	}
+	Local_OnLevelDataLoaded(LevelPackage);
+	return LevelDataCache.FindRef(LevelPackage);
+}
+
+void UOmegaZoneGameInstanceSubsystem::Local_OnLevelDataLoaded(FName LevelPackage)
+{
+	PendingLevelData.Remove(LevelPackage);
+	if(LevelDataCache.Contains(LevelPackage))
+	{
+		return;
+	}
+	const FSoftObjectPath AssetPath = GetLevelDataAssetPath(LevelPackage);
+	UOmegaLevelData* LoadedData = Cast<UOmegaLevelData>(AssetPath.ResolveObject());
+	if(!LoadedData)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No OmegaLevelData found for level: %s"), *LevelPackage.ToString());
+	}
+	LevelDataCache.Add(LevelPackage, LoadedData);
+
+	TArray<TFunction<void(UOmegaLevelData*)>> LocalCallbacks;
+	if(PendingLevelDataCallbacks.RemoveAndCopyValue(LevelPackage, LocalCallbacks))
+	{
+		for(TFunction<void(UOmegaLevelData*)>& TempCallback : LocalCallbacks)
+		{
+			TempCallback(LoadedData);
+		}
+	}
+}
+
 // =============================================================================================================
 // Zone Minimap
 // =============================================================================================================
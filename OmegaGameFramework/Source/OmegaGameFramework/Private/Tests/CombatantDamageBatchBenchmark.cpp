@@ -0,0 +1,109 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/OmegaBenchmarkWorld.h"
+#include "Components/Component_Combatant.h"
+#include "Misc/OmegaAttribute.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOmegaCombatantDamageBatchBenchmark, "OmegaGameFramework.Combatant.DamageBatchBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace OmegaCombatantDamageBatchBenchmark
+{
+	constexpr int32 NumTargets=100;
+	constexpr int32 HitsPerTarget=4;
+	constexpr int32 NumRuns=50;
+
+	void local_ResetTargets(const TArray<UCombatantComponent*>& Targets)
+	{
+		for(auto* TempTarget : Targets)
+		{
+			TempTarget->InitializeAttributes();
+		}
+	}
+}
+
+bool FOmegaCombatantDamageBatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OmegaCombatantDamageBatchBenchmark;
+
+	FOmegaBenchmarkWorld BenchmarkWorld;
+	UWorld* World=BenchmarkWorld.World;
+
+	// One attribute large enough that no run clamps it to 0.
+	UOmegaAttribute* Health=NewObject<UOmegaAttribute>(GetTransientPackage());
+	Health->MaxValue=1000000;
+	Health->StartValuePercentage=1;
+	UOmegaAttributeSet* AttributeSet=NewObject<UOmegaAttributeSet>(GetTransientPackage());
+	AttributeSet->Attributes.Add(Health);
+
+	TArray<UCombatantComponent*> Targets;
+	for(int32 i=0; i<NumTargets; ++i)
+	{
+		AActor* TargetActor=World->SpawnActor<AActor>();
+		UCombatantComponent* Combatant=NewObject<UCombatantComponent>(TargetActor);
+		Combatant->AttributeSet=AttributeSet;
+		Combatant->RegisterComponent();
+		Targets.Add(Combatant);
+	}
+	UCombatantComponent* Instigator=Targets[0];
+
+	// An area hit: every target takes several hits, in the order they would arrive.
+	TArray<FOmegaDamageRecord> Records;
+	for(int32 Hit=0; Hit<HitsPerTarget; ++Hit)
+	{
+		for(int32 i=0; i<NumTargets; ++i)
+		{
+			FOmegaDamageRecord TempRecord;
+			TempRecord.Target=Targets[i];
+			TempRecord.Attribute=Health;
+			TempRecord.BaseDamage=1+(i+Hit)%7;
+			Records.Add(TempRecord);
+		}
+	}
+
+	// Before: one ApplyAttributeDamage call per record.
+	local_ResetTargets(Targets);
+	TArray<float> SerialDamages;
+	double StartTime=FPlatformTime::Seconds();
+	for(int32 Run=0; Run<NumRuns; ++Run)
+	{
+		SerialDamages.Reset();
+		for(const FOmegaDamageRecord& TempRecord : Records)
+		{
+			SerialDamages.Add(TempRecord.Target->ApplyAttributeDamage(TempRecord.Attribute,TempRecord.BaseDamage,Instigator,nullptr,TempRecord.DamageType,TempRecord.Hit));
+		}
+	}
+	const double SerialTime=OmegaBenchmark_Milliseconds(StartTime)/NumRuns;
+	TArray<float> SerialValues;
+	for(auto* TempTarget : Targets)
+	{
+		SerialValues.Add(TempTarget->GetCurrentAttributeValues().FindRef(Health));
+	}
+
+	// After: the whole hit as one batch.
+	local_ResetTargets(Targets);
+	TArray<float> BatchDamages;
+	StartTime=FPlatformTime::Seconds();
+	for(int32 Run=0; Run<NumRuns; ++Run)
+	{
+		BatchDamages=UCombatantComponent::Native_ApplyAttributeDamageBatch(Records,Instigator,nullptr);
+	}
+	const double BatchTime=OmegaBenchmark_Milliseconds(StartTime)/NumRuns;
+
+	AddInfo(FString::Printf(TEXT("%d hits on %d targets: per target %.3f ms, batched %.3f ms"),Records.Num(),NumTargets,SerialTime,BatchTime));
+	TestTrue(TEXT("Batched damage matches the per target damage"),SerialDamages==BatchDamages);
+	for(int32 i=0; i<NumTargets; ++i)
+	{
+		if(!TestEqual(TEXT("Batched target ends on the per target value"),Targets[i]->GetCurrentAttributeValues().FindRef(Health),SerialValues[i]))
+		{
+			break;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,14 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/OmegaSubsystem_Grid3D.h"
+#include "Grid3DBenchmarkTile.generated.h"
+
+// AOmegaGrid3D_Tile is abstract. The Grid3D benchmarks spawn this plain subclass instead of a game's tile Blueprint.
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown, Transient)
+class AOmegaGrid3D_BenchmarkTile : public AOmegaGrid3D_Tile
+{
+	GENERATED_BODY()
+};
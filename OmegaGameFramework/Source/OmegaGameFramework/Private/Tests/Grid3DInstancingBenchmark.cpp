@@ -0,0 +1,95 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/OmegaBenchmarkWorld.h"
+#include "Tests/Grid3DBenchmarkTile.h"
+#include "Subsystems/OmegaSubsystem_Grid3D.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOmegaGrid3DInstancingBenchmark, "OmegaGameFramework.Grid3D.InstancingBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace OmegaGrid3DInstancingBenchmark
+{
+	struct FGenerateResult
+	{
+		double Milliseconds=0;
+		int64 UsedPhysicalBytes=0;
+		int32 NumObjects=0;
+	};
+
+	FGenerateResult local_GenerateTiles(UOmegaGrid3D_Map* Gridmap)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		const int64 UsedBefore=FPlatformMemory::GetStats().UsedPhysical;
+		const int32 ObjectsBefore=GUObjectArray.GetObjectArrayNumMinusAvailable();
+		const double StartTime=FPlatformTime::Seconds();
+		Gridmap->GenerateTiles();
+
+		FGenerateResult Result;
+		Result.Milliseconds=OmegaBenchmark_Milliseconds(StartTime);
+		Result.UsedPhysicalBytes=static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical)-UsedBefore;
+		Result.NumObjects=GUObjectArray.GetObjectArrayNumMinusAvailable()-ObjectsBefore;
+		return Result;
+	}
+}
+
+bool FOmegaGrid3DInstancingBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OmegaGrid3DInstancingBenchmark;
+
+	FOmegaBenchmarkWorld BenchmarkWorld;
+	UWorld* World=BenchmarkWorld.World;
+
+	UOmegaGrid3DTileType* TileType=NewObject<UOmegaGrid3DTileType>(GetTransientPackage());
+	TileType->TileMesh=LoadObject<UStaticMesh>(nullptr,TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if(!TestNotNull(TEXT("Engine cube mesh"),TileType->TileMesh))
+	{
+		return false;
+	}
+
+	// The 64x64x2 map from the request, 8192 tiles.
+	AActor* GridOwner=World->SpawnActor<AActor>();
+	UOmegaGrid3D_Map* Gridmap=NewObject<UOmegaGrid3D_Map>(GridOwner);
+	GridOwner->SetRootComponent(Gridmap);
+	Gridmap->RegisterComponent();
+	Gridmap->GridSize=FIntVector(64,64,2);
+	Gridmap->DefaultTileType=TileType;
+	Gridmap->TileClass=AOmegaGrid3D_BenchmarkTile::StaticClass();
+	const int32 NumTiles=64*64*2;
+
+	Gridmap->bUseInstancedTiles=true;
+	const FGenerateResult InstancedResult=local_GenerateTiles(Gridmap);
+	const UInstancedStaticMeshComponent* TileMesh=GridOwner->FindComponentByClass<UInstancedStaticMeshComponent>();
+	TestEqual(TEXT("Instanced map spawns no tile actors"),Gridmap->GetTiles().Num(),0);
+	TestTrue(TEXT("Instanced map draws every tile"),TileMesh && TileMesh->GetInstanceCount()==NumTiles);
+
+	// Coordinate queries never promote, promoting one tile removes its instance.
+	bool bFoundPath=false;
+	float PathCost=0;
+	Gridmap->FindPathCoordinates(FIntVector(0,0,0),FIntVector(63,63,1),FOmegaGrid3D_PathParams(),bFoundPath,PathCost);
+	TestTrue(TEXT("Path found on the instanced map"),bFoundPath);
+	TestEqual(TEXT("Pathing spawns no tile actors"),Gridmap->GetTiles().Num(),0);
+	TestNotNull(TEXT("Promoted tile"),Gridmap->PromoteTileToActor(FIntVector(10,10,0)));
+	TestTrue(TEXT("Promoted tile's instance is removed"),TileMesh && TileMesh->GetInstanceCount()==NumTiles-1);
+	Gridmap->DestroyTiles();
+
+	Gridmap->bUseInstancedTiles=false;
+	const FGenerateResult ActorResult=local_GenerateTiles(Gridmap);
+	TestEqual(TEXT("Actor map spawns a tile actor per tile"),Gridmap->GetTiles().Num(),NumTiles);
+	Gridmap->DestroyTiles();
+
+	AddInfo(FString::Printf(TEXT("GenerateTiles 64x64x2, actors:    %.2f ms, %d objects, %.2f MB"),
+		ActorResult.Milliseconds,ActorResult.NumObjects,ActorResult.UsedPhysicalBytes/(1024.0*1024.0)));
+	AddInfo(FString::Printf(TEXT("GenerateTiles 64x64x2, instanced: %.2f ms, %d objects, %.2f MB"),
+		InstancedResult.Milliseconds,InstancedResult.NumObjects,InstancedResult.UsedPhysicalBytes/(1024.0*1024.0)));
+	return true;
+}
+
+#endif
@@ -0,0 +1,153 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Subsystems/OmegaSubsystem_Grid3D.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOmegaGrid3DPathingBenchmark, "OmegaGameFramework.Grid3D.PathingBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace OmegaGrid3DPathingBenchmark
+{
+	constexpr int32 GridWidth=128;
+	constexpr int32 NumOrigins=64;
+	constexpr float MaxCost=12.0;
+
+	// How ranges were found before the cost grid: a flood fill that looks every tile up by coordinate.
+	int32 local_CountReachableByLookup(const TMap<FIntVector,float>& TileCosts, const FIntVector& Start, float InMaxCost)
+	{
+		static const FIntVector Offsets[4] = { FIntVector(1,0,0), FIntVector(-1,0,0), FIntVector(0,1,0), FIntVector(0,-1,0) };
+
+		TMap<FIntVector,float> cost_so_far;
+		TArray<TPair<float,FIntVector>> open_set;
+		const auto OpenPredicate=[](const TPair<float,FIntVector>& A, const TPair<float,FIntVector>& B) { return A.Key<B.Key; };
+		cost_so_far.Add(Start,0);
+		open_set.HeapPush(TPair<float,FIntVector>(0,Start),OpenPredicate);
+		while(!open_set.IsEmpty())
+		{
+			TPair<float,FIntVector> current;
+			open_set.HeapPop(current,OpenPredicate,EAllowShrinking::No);
+			if(current.Key>cost_so_far.FindChecked(current.Value))
+			{
+				continue;
+			}
+			for(const FIntVector& TempOffset : Offsets)
+			{
+				const FIntVector next=current.Value+TempOffset;
+				const float* tile_cost=TileCosts.Find(next);
+				if(!tile_cost || *tile_cost<0)
+				{
+					continue;
+				}
+				const float new_cost=current.Key+*tile_cost;
+				const float* existing_cost=cost_so_far.Find(next);
+				if(new_cost<=InMaxCost && (!existing_cost || new_cost<*existing_cost))
+				{
+					cost_so_far.Add(next,new_cost);
+					open_set.HeapPush(TPair<float,FIntVector>(new_cost,next),OpenPredicate);
+				}
+			}
+		}
+		return cost_so_far.Num();
+	}
+
+	double local_Milliseconds(double StartTime)
+	{
+		return (FPlatformTime::Seconds()-StartTime)*1000.0;
+	}
+}
+
+bool FOmegaGrid3DPathingBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OmegaGrid3DPathingBenchmark;
+
+	// Seeded 128x128 map with mixed costs and about 15% walls. The corners stay open for the long path.
+	FRandomStream Random(1337);
+	FOmegaGrid3D_CostGrid CostGrid;
+	CostGrid.Reset(FIntVector(GridWidth,GridWidth,1));
+	TMap<FIntVector,float> TileCosts;
+	TileCosts.Reserve(GridWidth*GridWidth);
+	for(int32 i=0; i<CostGrid.Costs.Num(); ++i)
+	{
+		const FIntVector coord=CostGrid.GetCoordinate(i);
+		const bool bCorner=(coord.X<2 || coord.X>=GridWidth-2) && (coord.Y<2 || coord.Y>=GridWidth-2);
+		const bool bWall=!bCorner && Random.FRand()<0.15f;
+		CostGrid.Costs[i]=bWall ? -1.0f : static_cast<float>(Random.RandRange(1,3));
+		CostGrid.BlocksLineOfEffect[i]=bWall;
+		TileCosts.Add(coord,CostGrid.Costs[i]);
+	}
+
+	TArray<FIntVector> Origins;
+	for(int32 i=0; i<NumOrigins; ++i)
+	{
+		FIntVector coord;
+		do
+		{
+			coord=FIntVector(Random.RandRange(0,GridWidth-1),Random.RandRange(0,GridWidth-1),0);
+		}
+		while(CostGrid.Costs[CostGrid.GetIndex(coord)]<0);
+		Origins.Add(coord);
+	}
+	const FOmegaGrid3D_PathParams Params;
+
+	// Path corner to corner
+	double StartTime=FPlatformTime::Seconds();
+	TArray<FIntVector> Path;
+	float PathCost=0;
+	const bool bFoundPath=CostGrid.FindPath(FIntVector(0,0,0),FIntVector(GridWidth-1,GridWidth-1,0),Params,Path,&PathCost);
+	AddInfo(FString::Printf(TEXT("FindPath 128x128 corner to corner: %.3f ms, %d tiles, cost %.1f"),local_Milliseconds(StartTime),Path.Num(),PathCost));
+	TestTrue(TEXT("Corner to corner path found"),bFoundPath);
+
+	// Ranges: coordinate lookups (before) against the cost grid, then serial against batched
+	StartTime=FPlatformTime::Seconds();
+	TArray<int32> LookupCounts;
+	for(const FIntVector& TempOrigin : Origins)
+	{
+		LookupCounts.Add(local_CountReachableByLookup(TileCosts,TempOrigin,MaxCost));
+	}
+	const double LookupTime=local_Milliseconds(StartTime);
+
+	StartTime=FPlatformTime::Seconds();
+	TArray<TArray<FIntVector>> SerialReachable;
+	SerialReachable.SetNum(Origins.Num());
+	for(int32 i=0; i<Origins.Num(); ++i)
+	{
+		CostGrid.GetReachable(Origins[i],MaxCost,Params,SerialReachable[i]);
+	}
+	const double SerialTime=local_Milliseconds(StartTime);
+
+	StartTime=FPlatformTime::Seconds();
+	TArray<TArray<FIntVector>> BatchReachable;
+	CostGrid.GetReachableBatch(Origins,MaxCost,Params,BatchReachable);
+	const double BatchTime=local_Milliseconds(StartTime);
+
+	AddInfo(FString::Printf(TEXT("Reachable within %.0f from %d origins: coordinate lookups %.3f ms, cost grid %.3f ms, cost grid batched %.3f ms"),
+		MaxCost,NumOrigins,LookupTime,SerialTime,BatchTime));
+	for(int32 i=0; i<Origins.Num(); ++i)
+	{
+		if(!TestEqual(TEXT("Cost grid range matches the lookup range"),SerialReachable[i].Num(),LookupCounts[i])
+			|| !TestEqual(TEXT("Batched range matches the serial range"),BatchReachable[i].Num(),SerialReachable[i].Num()))
+		{
+			break;
+		}
+	}
+
+	// Line of effect across the map
+	StartTime=FPlatformTime::Seconds();
+	int32 NumClear=0;
+	for(const FIntVector& TempStart : Origins)
+	{
+		for(const FIntVector& TempEnd : Origins)
+		{
+			NumClear+=CostGrid.HasLineOfEffect(TempStart,TempEnd) ? 1 : 0;
+		}
+	}
+	AddInfo(FString::Printf(TEXT("HasLineOfEffect %d pairs: %.3f ms, %d clear"),NumOrigins*NumOrigins,local_Milliseconds(StartTime),NumClear));
+	return true;
+}
+
+#endif
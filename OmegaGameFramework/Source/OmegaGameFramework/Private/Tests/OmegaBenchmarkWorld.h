@@ -0,0 +1,38 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+// A game world owned by a benchmark. Play is not started, so benchmarks drive the code they measure directly.
+struct FOmegaBenchmarkWorld
+{
+	UWorld* World = nullptr;
+
+	FOmegaBenchmarkWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+	}
+
+	~FOmegaBenchmarkWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+};
+
+// Milliseconds since a FPlatformTime::Seconds() timestamp.
+inline double OmegaBenchmark_Milliseconds(double StartTime)
+{
+	return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+#endif
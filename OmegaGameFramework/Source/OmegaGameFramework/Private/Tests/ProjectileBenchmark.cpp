@@ -0,0 +1,143 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/OmegaBenchmarkWorld.h"
+#include "Subsystems/OmegaSubsystem_Projectile.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOmegaProjectileBenchmark, "OmegaGameFramework.Projectiles.BulletBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace OmegaProjectileBenchmark
+{
+	constexpr int32 WaveSize=64;
+	constexpr int32 NumWaves=50;
+	constexpr int32 NumFrameBullets=1000;
+	constexpr int32 NumFrames=60;
+	constexpr float FrameTime=1.0f/60.0f;
+
+	// How every bullet was spawned before the pool.
+	AOmegaBulletActor* local_SpawnBulletActor(UWorld* World, const FTransform& Origin)
+	{
+		AOmegaBulletActor* NewBullet=World->SpawnActorDeferred<AOmegaBulletActor>(AOmegaBulletActor::StaticClass(),Origin,nullptr);
+		UGameplayStatics::FinishSpawningActor(NewBullet,Origin);
+		return NewBullet;
+	}
+
+	// A ring of shots in open space, so no bullet hits anything during the frames.
+	FTransform local_GetShotOrigin(int32 Index, int32 Count)
+	{
+		return FTransform(FRotator(0,360.0*Index/Count,0),FVector(0,0,10000));
+	}
+}
+
+bool FOmegaProjectileBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OmegaProjectileBenchmark;
+
+	FOmegaBenchmarkWorld BenchmarkWorld;
+	UWorld* World=BenchmarkWorld.World;
+	UOmegaProjectileSubsystem* Subsystem=World->GetSubsystem<UOmegaProjectileSubsystem>();
+	if(!TestNotNull(TEXT("Projectile subsystem"),Subsystem))
+	{
+		return false;
+	}
+	const FOmegaCustomScriptedEffects NoEffects;
+	TArray<AOmegaBulletActor*> Wave;
+
+	// Spawn rate: waves of shots that are all gone before the next wave, spawned and destroyed (before) against pooled.
+	double StartTime=FPlatformTime::Seconds();
+	for(int32 WaveIndex=0; WaveIndex<NumWaves; ++WaveIndex)
+	{
+		Wave.Reset();
+		for(int32 i=0; i<WaveSize; ++i)
+		{
+			Wave.Add(local_SpawnBulletActor(World,local_GetShotOrigin(i,WaveSize)));
+		}
+		for(auto* TempBullet : Wave)
+		{
+			TempBullet->Destroy();
+		}
+	}
+	const double SpawnTime=OmegaBenchmark_Milliseconds(StartTime);
+
+	// The first wave fills the pool and is not timed.
+	for(int32 WaveIndex=0; WaveIndex<=NumWaves; ++WaveIndex)
+	{
+		if(WaveIndex==1)
+		{
+			StartTime=FPlatformTime::Seconds();
+		}
+		Wave.Reset();
+		for(int32 i=0; i<WaveSize; ++i)
+		{
+			Wave.Add(Subsystem->Native_AcquireBullet(AOmegaBulletActor::StaticClass(),local_GetShotOrigin(i,WaveSize),NoEffects,nullptr));
+		}
+		for(auto* TempBullet : Wave)
+		{
+			Subsystem->Native_ReleaseBullet(TempBullet);
+		}
+	}
+	const double PoolTime=OmegaBenchmark_Milliseconds(StartTime);
+	TArray<AOmegaBulletActor*> LastWave=Wave;
+	Wave.Reset();
+	for(int32 i=0; i<WaveSize; ++i)
+	{
+		Wave.Add(Subsystem->Native_AcquireBullet(AOmegaBulletActor::StaticClass(),local_GetShotOrigin(i,WaveSize),NoEffects,nullptr));
+	}
+	Wave.Sort();
+	LastWave.Sort();
+	TestTrue(TEXT("A full wave is served from the pool"),Wave==LastWave);
+	Subsystem->EmptyBulletPools();
+	for(auto* TempBullet : Wave)
+	{
+		TempBullet->Destroy();
+	}
+
+	const int32 NumShots=WaveSize*NumWaves;
+	AddInfo(FString::Printf(TEXT("%d shots in waves of %d: spawn and destroy %.2f ms (%.0f shots/s), pooled %.2f ms (%.0f shots/s)"),
+		NumShots,WaveSize,SpawnTime,NumShots/(SpawnTime/1000.0),PoolTime,NumShots/(PoolTime/1000.0)));
+
+	// Frame time: bullet actors moved by their projectile components (before) against data bullets moved by the subsystem.
+	TArray<AOmegaBulletActor*> FrameBullets;
+	for(int32 i=0; i<NumFrameBullets; ++i)
+	{
+		FrameBullets.Add(local_SpawnBulletActor(World,local_GetShotOrigin(i,NumFrameBullets)));
+	}
+	StartTime=FPlatformTime::Seconds();
+	for(int32 Frame=0; Frame<NumFrames; ++Frame)
+	{
+		for(auto* TempBullet : FrameBullets)
+		{
+			TempBullet->ProjectileComponent->TickComponent(FrameTime,LEVELTICK_All,nullptr);
+		}
+	}
+	const double ActorFrameTime=OmegaBenchmark_Milliseconds(StartTime)/NumFrames;
+	for(auto* TempBullet : FrameBullets)
+	{
+		TempBullet->Destroy();
+	}
+
+	for(int32 i=0; i<NumFrameBullets; ++i)
+	{
+		Subsystem->Native_SpawnDataBullet(AOmegaBulletActor::StaticClass(),local_GetShotOrigin(i,NumFrameBullets),NoEffects,nullptr);
+	}
+	StartTime=FPlatformTime::Seconds();
+	for(int32 Frame=0; Frame<NumFrames; ++Frame)
+	{
+		Subsystem->Tick(FrameTime);
+	}
+	const double DataFrameTime=OmegaBenchmark_Milliseconds(StartTime)/NumFrames;
+	TestEqual(TEXT("No data bullet hit or expired during the frames"),Subsystem->GetActiveDataBulletCount(),NumFrameBullets);
+	Subsystem->ClearDataBullets();
+
+	AddInfo(FString::Printf(TEXT("%d bullets, %d frames: actors %.3f ms/frame, data bullets %.3f ms/frame"),
+		NumFrameBullets,NumFrames,ActorFrameTime,DataFrameTime));
+	return true;
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include "Components/HorizontalBox.h"
 #include "Components/VerticalBox.h"
 #include "Components/ScrollBox.h"
+#include "Components/Spacer.h"
 #include "Components/UniformGridPanel.h"
 #include "Components/PanelWidget.h"
 
@@ -19,6 +20,9 @@
 #include "Components/TextBlock.h"
 #include "Engine/DataAsset.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 
 UDataListCustomEntry::UDataListCustomEntry(const FObjectInitializer& ObjectInitializer)
@@ -85,28 +89,77 @@ void UDataList::SetNewControl(UUserWidget* NewWidget)
 
 void UDataList::ClearList()
 {
+	if(local_UsesPool())
+	{
+		for(auto* TempEntry : Entries)
+		{
+			local_ReleaseEntry(TempEntry);
+		}
+	}
 	if (ListPanel)
 	{
 		ListPanel->ClearChildren();
 	}
 	Entries.Empty();
+	VirtualEntries.Empty();
+	VirtualWindowStart = 0;
 	CurrentA = 0;
 	CurrentB = 0;
-
-	UE_LOG(LogTemp, Warning, TEXT("ListCleared"));
+	// The lead spacer has to come before every entry, so it goes back in first.
+	if(local_UsesVirtualScroll())
+	{
+		if(!VirtualLeadSpacer)
+		{
+			VirtualLeadSpacer = NewObject<USpacer>(this);
+		}
+		ListPanel->AddChild(VirtualLeadSpacer);
+	}
 }
 
 void UDataList::RemoveEntryFromList(int32 Index)
 {
+	if(bVirtualizeEntries)
+	{
+		if(VirtualEntries.IsValidIndex(Index))
+		{
+			VirtualEntries.RemoveAt(Index);
+			local_RefreshVirtualWindow();
+		}
+		return;
+	}
 	if(Entries.IsValidIndex(Index))		//check is valid index
 	{
-		Entries[Index]->RemoveFromParent();		//Remove from viewport
+		if(local_UsesPool())
+		{
+			local_ReleaseEntry(Entries[Index]);
+		}
+		else
+		{
+			Entries[Index]->RemoveFromParent();		//Remove from viewport
+		}
 		Entries.RemoveAt(Index);				//Remove from array of entries
 	}
 }
 
 void UDataList::RemoveEntryOfAsset(UObject* Asset, bool All)
 {
+	if(bVirtualizeEntries)
+	{
+		for(int32 i=0; i<VirtualEntries.Num(); ++i)
+		{
+			if(VirtualEntries[i].Asset == Asset)
+			{
+				VirtualEntries.RemoveAt(i--);
+				if(!All)
+				{
+					break;
+				}
+			}
+		}
+		local_RefreshVirtualWindow();
+		return;
+	}
+	
 	bool OneFound = false;
 	TArray<UDataWidget*> MarkedRemovals;
 	for(UDataWidget* TempEntry : Entries)
@@ -120,7 +173,7 @@ void UDataList::RemoveEntryOfAsset(UObject* Asset, bool All)
 
 	for(UDataWidget* TempEntry : MarkedRemovals)
 	{
-		RemoveEntryFromList(GetEntryIndex(TempEntry));
+		RemoveEntryFromList(Entries.Find(TempEntry));
 	}
 } 
 
@@ -134,50 +187,131 @@ UDataWidget* UDataList::AddAssetToList(UObject* Asset, FString Flag)
 	//Is Entry Class Valid?
 	if (!EntryClass)
 	{
-		return nullptr;
 		UE_LOG(LogTemp, Warning, TEXT("Failed to Add Asset. Invalid Widget Class."));
+		return nullptr;
+	}
+	if(!local_CanAddAsset(Asset))
+	{
+		return nullptr;
+	}
+
+	if(bVirtualizeEntries)
+	{
+		// Only materialize the entry if it lands inside the current window.
+		FDataListVirtualEntry NewEntry;
+		NewEntry.Asset = Asset;
+		NewEntry.Flag = Flag;
+		const int32 NewIndex = VirtualEntries.Add(NewEntry);
+		UDataWidget* NewWidget = nullptr;
+		if(NewIndex < VirtualWindowStart + VirtualWindowSize)
+		{
+			NewWidget = local_AddEntryWidget(Asset, Flag);
+		}
+		local_UpdateVirtualSpacers();
+		return NewWidget;
 	}
+	return local_AddEntryWidget(Asset, Flag);
+}
+
+bool UDataList::local_CanAddAsset(UObject* Asset)
+{
 	//check metadata
 	for(auto* TempMeta : EntryMetadata)
 	{
 		if(TempMeta && !TempMeta->CanAddObjectToList(Asset))
 		{
-			return nullptr;
+			return false;
+		}
+	}
+	// Do not add if hidden. Checked on a real entry, since overrides may read their list, tags or metadata.
+	if(FilterEntry && FilterEntry->GetClass() != EntryClass)
+	{
+		if(local_UsesPool())
+		{
+			local_ReleaseEntry(FilterEntry);
 		}
+		FilterEntry = nullptr;
+	}
+	if(!FilterEntry)
+	{
+		bool bRecycled;
+		FilterEntry = local_AcquireEntry(bRecycled);
+		bFilterEntryRecycled = bRecycled;
+	}
+	else
+	{
+		local_InitEntry(FilterEntry);
 	}
+	return !FilterEntry->IsEntityHidden(Asset);
+}
 
-	//Create Entry Widget
-	UDataWidget* TempEntry = CreateWidget<UDataWidget>(this, EntryClass);
+UDataWidget* UDataList::local_AcquireEntry(bool& bRecycled)
+{
+	UDataWidget* TempEntry = nullptr;
+	// The entry that just passed the hidden check is used first.
+	if(FilterEntry && FilterEntry->GetClass() == EntryClass)
+	{
+		TempEntry = FilterEntry;
+		bRecycled = bFilterEntryRecycled;
+		FilterEntry = nullptr;
+		local_InitEntry(TempEntry);
+		return TempEntry;
+	}
+	if(local_UsesPool())
+	{
+		FDataWidgetPool& ClassPool = EntryPool.FindOrAdd(EntryClass);
+		while(!TempEntry && !ClassPool.Widgets.IsEmpty())
+		{
+			TempEntry = ClassPool.Widgets.Pop(EAllowShrinking::No);
+		}
+	}
+	bRecycled = TempEntry != nullptr;
+	if(!TempEntry)
+	{
+		TempEntry = CreateWidget<UDataWidget>(this, EntryClass);
+	}
+	local_InitEntry(TempEntry);
+	return TempEntry;
+}
+
+void UDataList::local_InitEntry(UDataWidget* TempEntry)
+{
 	TempEntry->WidgetTags=EntryAutoTags;
 	TempEntry->WidgetMetadata=EntryMetadata;
 	TempEntry->bCanOverrideSize=bCanOverrideSize;
 	TempEntry->OverrideSize=OverrideSize;
-	
 	if(OverrideEntryTooltip)
 	{
 		TempEntry->DefaultTooltipWidget = OverrideEntryTooltip;
 	}
-	// Do not add if hidden
-	if(TempEntry->IsEntityHidden(Asset))
-	{
-		return nullptr;
-	}
-	
-	Entries.Add(TempEntry);
 	TempEntry->AssetLabel = EntryLabel;
 	TempEntry->ParentList = this;
-	if (Asset)
-	{
-		TempEntry->ReferencedAsset = Asset;
-	}
 	TempEntry->Script=Entry_Script;
 	
 	// Bind Delegates
-	TempEntry->OnSelected.AddDynamic(this, &UDataList::NativeEntitySelect);
-	TempEntry->OnHovered.AddDynamic(this, &UDataList::NativeEntityHover);
-	TempEntry->OnHighlight.AddDynamic(this, &UDataList::NativeEntityHighlight);
-	TempEntry->OnWidgetNotify.AddDynamic(this, &UDataList::Native_WidgetNotify);
+	TempEntry->OnSelected.AddUniqueDynamic(this, &UDataList::NativeEntitySelect);
+	TempEntry->OnHovered.AddUniqueDynamic(this, &UDataList::NativeEntityHover);
+	TempEntry->OnHighlight.AddUniqueDynamic(this, &UDataList::NativeEntityHighlight);
+	TempEntry->OnWidgetNotify.AddUniqueDynamic(this, &UDataList::Native_WidgetNotify);
+}
+
+void UDataList::local_ReleaseEntry(UDataWidget* Entry)
+{
+	if(!Entry)
+	{
+		return;
+	}
+	if(HoveredEntry == Entry)
+	{
+		HoveredEntry = nullptr;
+	}
+	Entry->bIsHighlighted = false;
+	Entry->RemoveFromParent();
+	EntryPool.FindOrAdd(Entry->GetClass()).Widgets.Add(Entry);
+}
 
+void UDataList::local_PlaceEntry(UDataWidget* TempEntry)
+{
 	UHorizontalBoxSlot* HSlotRef;
 	UVerticalBoxSlot* VSlotRef;
 	UUniformGridSlot* USlotRef;
@@ -250,13 +384,189 @@ UDataWidget* UDataList::AddAssetToList(UObject* Asset, FString Flag)
 			}
 		}
 	}
-	
-	UE_LOG(LogTemp, Warning, TEXT("Added WidgetToList"));
-	TempEntry->AddedToDataList(this, Entries.Find(TempEntry), Asset, ListTags, Flag);
+}
+
+UDataWidget* UDataList::local_AddEntryWidget(UObject* Asset, const FString& Flag)
+{
+	//Create Entry Widget
+	bool bRecycled;
+	UDataWidget* TempEntry = local_AcquireEntry(bRecycled);
+	Entries.Add(TempEntry);
+	TempEntry->ReferencedAsset = Asset;
+	local_PlaceEntry(TempEntry);
+	// New entries pick up their asset on construct, recycled ones need an explicit rebind.
+	if(bRecycled)
+	{
+		TempEntry->SetSourceAsset(Asset);
+	}
+	TempEntry->AddedToDataList(this, local_GetListIndex(TempEntry), Asset, ListTags, Flag);
 	
 	return TempEntry;
 }
 
+void UDataList::local_RefreshVirtualWindow()
+{
+	VirtualWindowStart = FMath::Clamp(VirtualWindowStart, 0, FMath::Max(VirtualEntries.Num() - VirtualWindowSize, 0));
+	const int32 WindowCount = FMath::Clamp(VirtualEntries.Num() - VirtualWindowStart, 0, VirtualWindowSize);
+
+	// Release entries that fall outside of the window
+	while(Entries.Num() > WindowCount)
+	{
+		local_ReleaseEntry(Entries.Pop(EAllowShrinking::No));
+	}
+	const int32 GridMax = FMath::Max(UniformGridMaxValue, 1);
+	CurrentA = Entries.Num() / GridMax;
+	CurrentB = Entries.Num() % GridMax;
+
+	// Rebind existing entries in place, then fill the rest of the window.
+	for(int32 i = 0; i < WindowCount; ++i)
+	{
+		const FDataListVirtualEntry& VirtualEntry = VirtualEntries[VirtualWindowStart + i];
+		if(Entries.IsValidIndex(i))
+		{
+			if(Entries[i]->ReferencedAsset != VirtualEntry.Asset)
+			{
+				Entries[i]->SetHighlighted(false);
+				Entries[i]->SetSourceAsset(VirtualEntry.Asset);
+				Entries[i]->AddedToDataList(this, VirtualWindowStart + i, VirtualEntry.Asset, ListTags, VirtualEntry.Flag);
+			}
+		}
+		else
+		{
+			local_AddEntryWidget(VirtualEntry.Asset, VirtualEntry.Flag);
+		}
+	}
+	local_UpdateVirtualSpacers();
+}
+
+bool UDataList::local_UsesVirtualScroll() const
+{
+	return bVirtualizeEntries && !ListFormat && Format == EDataListFormat::Format_ScrollBox && Cast<UScrollBox>(ListPanel);
+}
+
+float UDataList::local_GetVirtualEntryExtent()
+{
+	if(VirtualEntryExtent > 0)
+	{
+		return VirtualEntryExtent;
+	}
+	// Desired size is only known after the first layout pass, so keep the first real measurement.
+	if(VirtualMeasuredExtent <= 0)
+	{
+		for(const UDataWidget* TempEntry : Entries)
+		{
+			if(TempEntry)
+			{
+				const FVector2D EntrySize = TempEntry->GetDesiredSize();
+				VirtualMeasuredExtent = Orientation == EOrientation::Orient_Horizontal ? EntrySize.X : EntrySize.Y;
+				break;
+			}
+		}
+	}
+	return VirtualMeasuredExtent;
+}
+
+void UDataList::local_UpdateVirtualSpacers()
+{
+	if(!local_UsesVirtualScroll() || !VirtualLeadSpacer)
+	{
+		return;
+	}
+	if(!VirtualTrailSpacer)
+	{
+		VirtualTrailSpacer = NewObject<USpacer>(this);
+	}
+	// Keep the trail spacer after the newest entry
+	if(ListPanel->GetChildIndex(VirtualTrailSpacer) != ListPanel->GetChildrenCount() - 1)
+	{
+		ListPanel->RemoveChild(VirtualTrailSpacer);
+		ListPanel->AddChild(VirtualTrailSpacer);
+	}
+	const float Extent = local_GetVirtualEntryExtent();
+	const float LeadSize = VirtualWindowStart * Extent;
+	const float TrailSize = FMath::Max(VirtualEntries.Num() - VirtualWindowStart - Entries.Num(), 0) * Extent;
+	if(Orientation == EOrientation::Orient_Horizontal)
+	{
+		VirtualLeadSpacer->SetSize(FVector2D(LeadSize, 0));
+		VirtualTrailSpacer->SetSize(FVector2D(TrailSize, 0));
+	}
+	else
+	{
+		VirtualLeadSpacer->SetSize(FVector2D(0, LeadSize));
+		VirtualTrailSpacer->SetSize(FVector2D(0, TrailSize));
+	}
+}
+
+void UDataList::local_OnListUserScrolled(float CurrentOffset)
+{
+	if(!local_UsesVirtualScroll())
+	{
+		return;
+	}
+	const float Extent = local_GetVirtualEntryExtent();
+	if(Extent <= 0)
+	{
+		local_UpdateVirtualSpacers();
+		return;
+	}
+	// The lead spacer is exactly as long as the assets before the window, so the scroll offset stays on the same asset.
+	SetVirtualWindowStart(FMath::FloorToInt(CurrentOffset / Extent));
+}
+
+void UDataList::local_ScrollVirtualWindowTo(int32 Index)
+{
+	int32 NewStart = VirtualWindowStart;
+	if(Index < NewStart)
+	{
+		NewStart = Index;
+	}
+	else if(Index >= NewStart + VirtualWindowSize)
+	{
+		NewStart = Index - VirtualWindowSize + 1;
+	}
+	// Keep uniform grid rows aligned
+	if(!ListFormat && Format == EDataListFormat::Format_UniformGrid && UniformGridMaxValue > 1 && NewStart != VirtualWindowStart)
+	{
+		NewStart = (NewStart > VirtualWindowStart)
+			? FMath::DivideAndRoundUp(NewStart, UniformGridMaxValue) * UniformGridMaxValue
+			: (NewStart / UniformGridMaxValue) * UniformGridMaxValue;
+	}
+	SetVirtualWindowStart(NewStart);
+}
+
+int32 UDataList::local_GetListIndex(UDataWidget* Entry) const
+{
+	const int32 EntryIndex = Entries.Find(Entry);
+	if(bVirtualizeEntries && EntryIndex != INDEX_NONE)
+	{
+		return EntryIndex + VirtualWindowStart;
+	}
+	return EntryIndex;
+}
+
+void UDataList::SetVirtualWindowStart(int32 NewStart)
+{
+	if(!bVirtualizeEntries)
+	{
+		return;
+	}
+	NewStart = FMath::Clamp(NewStart, 0, FMath::Max(VirtualEntries.Num() - VirtualWindowSize, 0));
+	if(NewStart != VirtualWindowStart)
+	{
+		VirtualWindowStart = NewStart;
+		local_RefreshVirtualWindow();
+	}
+}
+
+int32 UDataList::GetNumListedAssets() const
+{
+	if(bVirtualizeEntries)
+	{
+		return VirtualEntries.Num();
+	}
+	return Entries.Num();
+}
+
 TArray<UDataWidget*> UDataList::AddAssetsToList(TArray<UObject*> Assets, FString Flag, bool ClearListFirst)
 {
 	if (ClearListFirst)
@@ -267,13 +577,289 @@ TArray<UDataWidget*> UDataList::AddAssetsToList(TArray<UObject*> Assets, FString
 	TArray<UDataWidget*> LocalEntryList;
 	for (UObject* TempAsset : Assets)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Attempted to add Widget To List"));
 		UDataWidget* LocalEntry = AddAssetToList(TempAsset, Flag);
 		LocalEntryList.Add(LocalEntry);
 	}
 	return LocalEntryList;
 }
 
+TArray<UDataWidget*> UDataList::SyncAssetsToList(TArray<UObject*> Assets, FString Flag, bool bRefreshKeptEntries)
+{
+	if(!EntryClass)
+	{
+		return Entries;
+	}
+	UObject* HoveredAsset = HoveredEntry ? HoveredEntry->ReferencedAsset : nullptr;
+
+	TArray<UObject*> NewAssets;
+	NewAssets.Reserve(Assets.Num());
+	for(UObject* TempAsset : Assets)
+	{
+		if(TempAsset && local_CanAddAsset(TempAsset))
+		{
+			NewAssets.Add(TempAsset);
+		}
+	}
+
+	// Virtualized lists only need the data swapped, the window rebinds just the entries whose asset changed.
+	if(bVirtualizeEntries)
+	{
+		VirtualEntries.Reset(NewAssets.Num());
+		for(UObject* TempAsset : NewAssets)
+		{
+			FDataListVirtualEntry NewEntry;
+			NewEntry.Asset = TempAsset;
+			NewEntry.Flag = Flag;
+			VirtualEntries.Add(NewEntry);
+		}
+		local_RefreshVirtualWindow();
+		local_RestoreHoverIndex(HoveredAsset);
+		return Entries;
+	}
+
+	// Match the current entries to the incoming assets. Duplicated assets are matched in list order.
+	TMap<UObject*, TArray<UDataWidget*>> EntriesByAsset;
+	for(UDataWidget* TempEntry : Entries)
+	{
+		if(TempEntry)
+		{
+			EntriesByAsset.FindOrAdd(TempEntry->ReferencedAsset).Add(TempEntry);
+		}
+	}
+	TArray<UDataWidget*> NewEntries;
+	NewEntries.Reserve(NewAssets.Num());
+	for(UObject* TempAsset : NewAssets)
+	{
+		UDataWidget* KeptEntry = nullptr;
+		if(TArray<UDataWidget*>* Matches = EntriesByAsset.Find(TempAsset))
+		{
+			if(Matches->Num())
+			{
+				KeptEntry = (*Matches)[0];
+				Matches->RemoveAt(0, 1, EAllowShrinking::No);
+			}
+		}
+		NewEntries.Add(KeptEntry);
+	}
+
+	// Remove entries whose asset is no longer listed.
+	TSet<UDataWidget*> RemovedEntries;
+	for(const TPair<UObject*, TArray<UDataWidget*>>& Pair : EntriesByAsset)
+	{
+		for(UDataWidget* TempEntry : Pair.Value)
+		{
+			RemovedEntries.Add(TempEntry);
+			if(local_UsesPool())
+			{
+				local_ReleaseEntry(TempEntry);
+			}
+			else
+			{
+				TempEntry->RemoveFromParent();
+			}
+		}
+	}
+	if(RemovedEntries.Contains(HoveredEntry))
+	{
+		HoveredEntry = nullptr;
+	}
+	Entries.RemoveAll([&RemovedEntries](const UDataWidget* TempEntry){ return !TempEntry || RemovedEntries.Contains(TempEntry); });
+
+	// Kept entries whose order relative to the other kept entries is unchanged stay where they are.
+	// The rest (the longest run in old order aside) count as moved and are told their new index.
+	TMap<UDataWidget*, int32> OldIndices;
+	for(int32 i = 0; i < Entries.Num(); ++i)
+	{
+		OldIndices.Add(Entries[i], i);
+	}
+	TSet<UDataWidget*> MovedEntries;
+	{
+		TArray<UDataWidget*> KeptOrder;
+		for(UDataWidget* TempEntry : NewEntries)
+		{
+			if(TempEntry)
+			{
+				KeptOrder.Add(TempEntry);
+			}
+		}
+		// Longest increasing run of old indices, O(n log n)
+		TArray<int32> RunTails;
+		TArray<int32> RunTailIndex;
+		TArray<int32> PrevInRun;
+		PrevInRun.Init(INDEX_NONE, KeptOrder.Num());
+		for(int32 i = 0; i < KeptOrder.Num(); ++i)
+		{
+			const int32 OldIndex = OldIndices[KeptOrder[i]];
+			const int32 Pos = Algo::LowerBound(RunTails, OldIndex);
+			if(Pos > 0)
+			{
+				PrevInRun[i] = RunTailIndex[Pos - 1];
+			}
+			if(Pos == RunTails.Num())
+			{
+				RunTails.Add(OldIndex);
+				RunTailIndex.Add(i);
+			}
+			else
+			{
+				RunTails[Pos] = OldIndex;
+				RunTailIndex[Pos] = i;
+			}
+		}
+		TSet<UDataWidget*> StayedEntries;
+		for(int32 i = RunTailIndex.IsEmpty() ? INDEX_NONE : RunTailIndex.Last(); i != INDEX_NONE; i = PrevInRun[i])
+		{
+			StayedEntries.Add(KeptOrder[i]);
+		}
+		for(UDataWidget* TempEntry : KeptOrder)
+		{
+			if(!StayedEntries.Contains(TempEntry))
+			{
+				MovedEntries.Add(TempEntry);
+			}
+		}
+	}
+
+	// Walk the new order once. New entries are added and moved into place, kept entries are only shifted when out of place.
+	const bool bIsGrid = !ListFormat && Format == EDataListFormat::Format_UniformGrid;
+	bool bSlotOrderChanged = false;
+	Entries.Reset(NewEntries.Num());
+	for(int32 i = 0; i < NewEntries.Num(); ++i)
+	{
+		UDataWidget* TempEntry = NewEntries[i];
+		if(!TempEntry)
+		{
+			TempEntry = local_AddEntryWidget(NewAssets[i], Flag);
+		}
+		else
+		{
+			Entries.Add(TempEntry);
+			if(MovedEntries.Contains(TempEntry))
+			{
+				TempEntry->AddedToDataList(this, i, TempEntry->ReferencedAsset, ListTags, Flag);
+			}
+		}
+		if(bIsGrid)
+		{
+			if(UUniformGridSlot* TempSlot = Cast<UUniformGridSlot>(TempEntry->Slot))
+			{
+				int32 InRow;
+				int32 InCol;
+				local_GetGridPosition(i, InRow, InCol);
+				if(TempSlot->GetRow() != InRow || TempSlot->GetColumn() != InCol)
+				{
+					TempSlot->SetRow(InRow);
+					TempSlot->SetColumn(InCol);
+				}
+			}
+		}
+		// List formats may nest entries in their own panels, only entries placed directly in the list panel are shifted.
+		else if(ListPanel && TempEntry->GetParent() == ListPanel && ListPanel->GetChildIndex(TempEntry) != i)
+		{
+			ListPanel->ShiftChild(i, TempEntry);
+			bSlotOrderChanged = true;
+		}
+	}
+	const int32 GridMax = FMath::Max(UniformGridMaxValue, 1);
+	CurrentA = Entries.Num() / GridMax;
+	CurrentB = Entries.Num() % GridMax;
+	if(bSlotOrderChanged)
+	{
+		local_RebuildListPanelSlate();
+	}
+
+	if(bRefreshKeptEntries)
+	{
+		for(UDataWidget* TempEntry : NewEntries)
+		{
+			if(TempEntry)
+			{
+				TempEntry->Refresh();
+			}
+		}
+	}
+	local_RestoreHoverIndex(HoveredAsset);
+	return Entries;
+}
+
+void UDataList::local_RebuildListPanelSlate()
+{
+	if(bListPanelSlatePending || !ListPanel || !ListPanel->GetCachedWidget().IsValid())
+	{
+		return;
+	}
+	if(!GetWorld())
+	{
+		local_FlushListPanelSlate();
+		return;
+	}
+	// Every insert or move in a frame collapses into a single panel rebuild.
+	bListPanelSlatePending = true;
+	GetWorld()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		local_FlushListPanelSlate();
+	}));
+}
+
+void UDataList::local_FlushListPanelSlate()
+{
+	// ShiftChild only reorders the panel's slots. Slate picks up the new order when the panel widget is rebuilt,
+	// which reuses every entry's existing widget.
+	bListPanelSlatePending = false;
+	if(!ListPanel || !ParentPanel || !ListPanel->GetCachedWidget().IsValid())
+	{
+		return;
+	}
+	UScrollBox* ScrollPanel = Cast<UScrollBox>(ListPanel);
+	const float ScrollOffset = ScrollPanel ? ScrollPanel->GetScrollOffset() : 0.0f;
+	ParentPanel->RemoveChild(ListPanel);
+	ListPanel->ReleaseSlateResources(false);
+	local_AddListPanelToCanvas();
+	if(ScrollPanel)
+	{
+		ScrollPanel->SetScrollOffset(ScrollOffset);
+	}
+}
+
+void UDataList::local_AddListPanelToCanvas()
+{
+	ParentPanel->AddChildToCanvas(ListPanel);
+	UCanvasPanelSlot* TempSlot = UWidgetLayoutLibrary::SlotAsCanvasSlot(ListPanel);
+	const FAnchors DumAnc = FAnchors(0.0, 0.0, 1.0, 1.0);
+	const FVector2D DumVec = FVector2D(0.0);
+	TempSlot->SetAnchors(DumAnc);
+	TempSlot->SetSize(DumVec);
+	TempSlot->SetAutoSize(bAutoSizeList);
+}
+
+void UDataList::local_GetGridPosition(int32 Index, int32& Row, int32& Column) const
+{
+	const int32 GridMax = FMath::Max(UniformGridMaxValue, 1);
+	const int32 InA = Index / GridMax;
+	const int32 InB = Index % GridMax;
+	Row = Orientation == EOrientation::Orient_Horizontal ? InA : InB;
+	Column = Orientation == EOrientation::Orient_Horizontal ? InB : InA;
+}
+
+void UDataList::local_RestoreHoverIndex(UObject* HoveredAsset)
+{
+	const int32 NumAssets = GetNumListedAssets();
+	if(HoveredEntry && HoveredEntry->ReferencedAsset == HoveredAsset)
+	{
+		RememberedHoverIndex = local_GetListIndex(HoveredEntry);
+	}
+	else if(bVirtualizeEntries && HoveredAsset)
+	{
+		const int32 AssetIndex = VirtualEntries.IndexOfByPredicate([HoveredAsset](const FDataListVirtualEntry& TempEntry){ return TempEntry.Asset == HoveredAsset; });
+		if(AssetIndex != INDEX_NONE)
+		{
+			RememberedHoverIndex = AssetIndex;
+			return;
+		}
+	}
+	RememberedHoverIndex = FMath::Clamp(RememberedHoverIndex, 0, FMath::Max(NumAssets - 1, 0));
+}
+
 UDataWidget* UDataList::AddedCustomEntryToList(FCustomAssetData EntryData, FString Flag)
 {
 	return AddAssetToList(Native_CreateCustomDataObject(EntryData), Flag);
@@ -319,6 +905,10 @@ void UDataList::HoverEntry(int32 Index,bool UseLastIndex)
 	{
 		incoming_index=RememberedHoverIndex;
 	}
+	if(bVirtualizeEntries && VirtualEntries.IsValidIndex(incoming_index))
+	{
+		local_ScrollVirtualWindowTo(incoming_index);
+	}
 	
 	if(GetEntry(incoming_index))
 	{
@@ -364,6 +954,27 @@ bool UDataList::CycleEntry(int32 Amount,int32& NewEntry)
 	UE_LOG(LogTemp, Warning, TEXT("Failed to Cycle DataList: Cycle Amount is 0"));
 		return false;
 	}
+
+	// Virtualized lists cycle over every listed asset, not only the materialized entries.
+	if(bVirtualizeEntries)
+	{
+		if(VirtualEntries.IsEmpty())
+		{
+			return false;
+		}
+		int32 Tempindex = (HoveredEntry ? local_GetListIndex(HoveredEntry) : 0)+Amount;
+		if(Tempindex < 0)
+		{
+			Tempindex = VirtualEntries.Num()-1;
+		}
+		else if(Tempindex > VirtualEntries.Num()-1)
+		{
+			Tempindex = 0;
+		}
+		HoverEntry(Tempindex);
+		NewEntry = Tempindex;
+		return true;
+	}
 	
 	if(HoveredEntry)
 	{
@@ -403,6 +1014,10 @@ bool UDataList::CycleEntry(int32 Amount,int32& NewEntry)
 
 int32 UDataList::GetEntryIndex(UDataWidget* Entry)
 {
+	if(Entry && bVirtualizeEntries)
+	{
+		return local_GetListIndex(Entry);
+	}
 	if(Entry)
 	{
 		if(GetEntries().Contains(Entry))
@@ -416,6 +1031,11 @@ int32 UDataList::GetEntryIndex(UDataWidget* Entry)
 
 UDataWidget* UDataList::GetEntry(int32 Index)
 {
+	if(bVirtualizeEntries)
+	{
+		const int32 WindowIndex = Index - VirtualWindowStart;
+		return Entries.IsValidIndex(WindowIndex) ? Entries[WindowIndex] : nullptr;
+	}
 	if(GetEntries().IsValidIndex(Index))
 	{
 		return GetEntries()[Index];
@@ -665,6 +1285,7 @@ void UDataList::RebuildList()
 		case EDataListFormat::Format_ScrollBox:
 			BuildList(UScrollBox::StaticClass());
 			Cast<UScrollBox>(ListPanel)->SetOrientation(Orientation);
+			Cast<UScrollBox>(ListPanel)->OnUserScrolled.AddUniqueDynamic(this, &UDataList::local_OnListUserScrolled);
 			break;
 		case EDataListFormat::Format_UniformGrid:
 			BuildList(UUniformGridPanel::StaticClass());
@@ -673,13 +1294,7 @@ void UDataList::RebuildList()
 	}
 
 	//Add to Content Panel and Align
-	ParentPanel->AddChildToCanvas(ListPanel);
-	UCanvasPanelSlot* TempSlot = UWidgetLayoutLibrary::SlotAsCanvasSlot(ListPanel);
-	const FAnchors DumAnc = FAnchors(0.0, 0.0, 1.0, 1.0);
-	const FVector2D DumVec = FVector2D(0.0);
-	TempSlot->SetAnchors(DumAnc);
-	TempSlot->SetSize(DumVec);
-	TempSlot->SetAutoSize(bAutoSizeList);
+	local_AddListPanelToCanvas();
 	
 	///Assets and ENtires
 	CurrentA = 0;
@@ -742,7 +1357,7 @@ void UDataList::NativeEntitySelect(UDataWidget* DataWidget)
 		}
 	}
 	
-	OnEntrySelected.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, Entries.Find(DataWidget));
+	OnEntrySelected.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, local_GetListIndex(DataWidget));
 }
 
 void UDataList::NativeEntityHover(UDataWidget* DataWidget, bool bIsHovered)
@@ -791,7 +1406,7 @@ void UDataList::NativeEntityHover(UDataWidget* DataWidget, bool bIsHovered)
 		{
 			GetOwningLocalPlayer()->GetSubsystem<UOmegaPlayerSubsystem>()->SetControlWidget(this);
 		}
-		RememberedHoverIndex = Entries.Find(DataWidget);
+		RememberedHoverIndex = local_GetListIndex(DataWidget);
 		OnEntryHovered.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, RememberedHoverIndex);
 	}
 	else
@@ -809,7 +1424,7 @@ void UDataList::NativeEntityHover(UDataWidget* DataWidget, bool bIsHovered)
 			}
 		}
 		
-		OnEntryUnhovered.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, Entries.Find(DataWidget));
+		OnEntryUnhovered.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, local_GetListIndex(DataWidget));
 		if(DescriptionTextBlock)
 		{
 			DescriptionTextBlock->SetText(FText::FromString(""));
@@ -819,14 +1434,14 @@ void UDataList::NativeEntityHover(UDataWidget* DataWidget, bool bIsHovered)
 
 void UDataList::NativeEntityHighlight(UDataWidget* DataWidget, bool bIsHighlighted)
 {
-	OnEntryHighlighted.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, Entries.Find(DataWidget), bIsHighlighted);
+	OnEntryHighlighted.Broadcast(DataWidget, DataWidget->GetAssetLabel(), DataWidget->ReferencedAsset, local_GetListIndex(DataWidget), bIsHighlighted);
 }
 
 void UDataList::SetEntryHighlighted(int32 Index, bool bHighlighted)
 {
-	if(GetEntries().IsValidIndex(Index))
+	if(UDataWidget* TempEntry = GetEntry(Index))
 	{
-		GetEntries()[Index]->SetHighlighted(bHighlighted);
+		TempEntry->SetHighlighted(bHighlighted);
 	}
 }
 
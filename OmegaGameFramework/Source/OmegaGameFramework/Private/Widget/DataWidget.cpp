@@ -17,6 +17,7 @@
 #include "Widget/DataList.h"
 #include "TimerManager.h"
 #include "Functions/OmegaFunctions_Utility.h"
+#include "Components/Component_Combatant.h"
 #include "..\..\Public\OmegaSettings_Slate.h"
 
 bool UDataWidgetMetadata::CanAddObjectToList_Implementation(UObject* SourceObject) const
@@ -252,14 +253,15 @@ void UDataWidget::Native_OnRefreshed(UObject* SourceAsset, UObject* ListOwner)
 void UDataWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
+	UCombatantComponent::BindCombatantWidget(this);
 
 	//Create default metadata if invalid
 
 	
 	if (GetButtonWidget())
 	{
-		GetButtonWidget()->OnClicked.AddDynamic(this, &UDataWidget::Select);
-		GetButtonWidget()->OnHovered.AddDynamic(this, &UDataWidget::Hover);
+		GetButtonWidget()->OnClicked.AddUniqueDynamic(this, &UDataWidget::Select);
+		GetButtonWidget()->OnHovered.AddUniqueDynamic(this, &UDataWidget::Hover);
 	}
 
 	TSubclassOf<UDataTooltip> LocalTooltipClass;
@@ -280,7 +282,7 @@ void UDataWidget::NativeConstruct()
 		if(Cast<UDataWidget>(UCommonUILibrary::FindParentWidgetOfType(this, UDataWidget::StaticClass())))
 		{
 			OwnerDataWidget = Cast<UDataWidget>(UCommonUILibrary::FindParentWidgetOfType(this, UDataWidget::StaticClass()));
-			OwnerDataWidget->OnWidgetRefreshed.AddDynamic(this, &UDataWidget::private_refresh);
+			OwnerDataWidget->OnWidgetRefreshed.AddUniqueDynamic(this, &UDataWidget::private_refresh);
 		}
 	}
 	Local_UpdateTooltip(ReferencedAsset);
@@ -493,6 +495,7 @@ void UDataWidget::SetSourceAsset(UObject* Asset)
 
 		OnSourceAssetChanged(Asset);
 		Refresh();
+		UCombatantComponent::BindCombatantWidget(this);
 	}
 	
 }
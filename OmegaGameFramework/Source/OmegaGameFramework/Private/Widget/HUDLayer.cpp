@@ -6,6 +6,7 @@
 #include "Subsystems/OmegaSubsystem_GameManager.h"
 #include "Subsystems/OmegaSubsystem_Message.h"
 #include "Subsystems/OmegaSubsystem_Player.h"
+#include "Components/Component_Combatant.h"
 
 //#include "Engine/Engine.h"
 
@@ -16,6 +17,7 @@ void UHUDLayer::NativeConstruct()
 	GetGameInstance()->GetSubsystem<UOmegaMessageSubsystem>()->OnGameplayMessage.AddDynamic(this, &UHUDLayer::OnGameplayMessage);
 	GetOwningLocalPlayer()->GetSubsystem<UOmegaPlayerSubsystem>()->OnInputDeviceChanged.AddDynamic(this, &UHUDLayer::OnInputMethodChanged);
 	PlayAnimationForward(GetAppearAnimation());
+	UCombatantComponent::BindCombatantWidget(this);
 }
 
 void UHUDLayer::OnAnimationFinished_Implementation(const UWidgetAnimation* Animation)
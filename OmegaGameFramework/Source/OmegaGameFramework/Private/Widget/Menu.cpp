@@ -10,6 +10,7 @@
 #include "Subsystems/OmegaSubsystem_GameManager.h"
 #include "Subsystems/OmegaSubsystem_Gameplay.h"
 #include "Subsystems/OmegaSubsystem_Player.h"
+#include "Components/Component_Combatant.h"
 
 
 void UMenu::OpenMenu(FGameplayTagContainer Tags, UObject* Context, APlayerController* PlayerRef, const FString& Flag)
@@ -149,6 +150,7 @@ void UMenu::OnAnimationFinished_Implementation(const UWidgetAnimation* MovieScen
 void UMenu::NativeConstruct()
 {
 	Super::NativeConstruct();
+	UCombatantComponent::BindCombatantWidget(this);
 }
 
 void UMenu::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
@@ -3,17 +3,58 @@
 
 #include "Widget/Widget_DynamicMeter.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Engine/GameInstance.h"
+#include "Subsystems/OmegaSubsystem_Tween.h"
 
 
-void UDynamicProgressMeter::Tick(float DeltaTime)
+void UDynamicProgressMeter::local_StartGhostInterp()
 {
-	if(bInterpGhostToPercent)
+	UOmegaTweenSubsystem* TweenSubsystem = GetWorld() && GetWorld()->GetGameInstance() ? GetWorld()->GetGameInstance()->GetSubsystem<UOmegaTweenSubsystem>() : nullptr;
+	if(!TweenSubsystem)
 	{
-		if(Percent_Progress!=Percent_Ghost)
+		return;
+	}
+	TweenSubsystem->Native_CancelTween(GhostTweenHandle);
+	GhostTweenHandle = INDEX_NONE;
+	if(!bInterpGhostToPercent || Percent_Progress==Percent_Ghost)
+	{
+		return;
+	}
+
+	const float StartValue = Percent_Ghost;
+	const float TargetValue = Percent_Progress;
+
+	// Same constant speed as before: a full bar takes GhostInterpTime.
+	FOmegaTween NewTween;
+	NewTween.EndTime = FMath::Abs(TargetValue-StartValue)*GhostInterpTime;
+	NewTween.World = GetWorld();
+	NewTween.Owner = this;
+
+	TWeakObjectPtr<UDynamicProgressMeter> WeakThis(this);
+	NewTween.OnUpdate = [WeakThis, StartValue, TargetValue](float Alpha)
+	{
+		if(WeakThis.IsValid())
 		{
-			float new_val=UKismetMathLibrary::FInterpTo_Constant(Percent_Ghost,Percent_Progress,DeltaTime,1/GhostInterpTime);
-			SetPercent_Ghost(new_val);
+			WeakThis->local_SetGhostValue(FMath::Lerp(StartValue, TargetValue, Alpha));
 		}
+	};
+	NewTween.OnFinished = [WeakThis, TargetValue]()
+	{
+		if(WeakThis.IsValid())
+		{
+			WeakThis->GhostTweenHandle = INDEX_NONE;
+			WeakThis->local_SetGhostValue(TargetValue);
+		}
+	};
+	GhostTweenHandle = TweenSubsystem->Native_AddTween(MoveTemp(NewTween));
+}
+
+void UDynamicProgressMeter::local_SetGhostValue(float value)
+{
+	if(GetDynamicMaterial())
+	{
+		Percent_Ghost=value;
+		GetDynamicMaterial()->SetScalarParameterValue(MaterialParam_Ghost,Percent_Ghost);
 	}
 }
 
@@ -38,18 +79,16 @@ void UDynamicProgressMeter::SetPercent_Progress(const float& value)
 		GetDynamicMaterial()->SetScalarParameterValue(MaterialParam_Progress,value);
 		if(bClampGhostToProgress)
 		{
-			SetPercent_Ghost(UKismetMathLibrary::FClamp(Percent_Ghost,Percent_Progress,1.0));
+			local_SetGhostValue(UKismetMathLibrary::FClamp(Percent_Ghost,Percent_Progress,1.0));
 		}
+		local_StartGhostInterp();
 	}
 }
 
 void UDynamicProgressMeter::SetPercent_Ghost(const float& value)
 {
-	if(GetDynamicMaterial())
-	{
-		Percent_Ghost=value;
-		GetDynamicMaterial()->SetScalarParameterValue(MaterialParam_Ghost,Percent_Ghost);
-	}
+	local_SetGhostValue(value);
+	local_StartGhostInterp();
 }
 
 void UDynamicProgressMeter::SetProgress_Color(const FLinearColor& value)
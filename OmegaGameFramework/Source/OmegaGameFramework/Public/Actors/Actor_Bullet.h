@@ -23,6 +23,8 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	//Pooled bullets return to the pool when their life span ends instead of being destroyed.
+	virtual void LifeSpanExpired() override;
 
 	UFUNCTION()
 	void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult &SweepResult);
@@ -33,6 +35,10 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category="Bullet")
 	void OnImpact(AActor* Actor, UCombatantComponent* Combatant);
 
+	//Called when the bullet is spawned, and each time it is reused from the pool.
+	UFUNCTION(BlueprintImplementableEvent, Category="Bullet")
+	void OnBulletActivated();
+
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Components")
 	UCombatantComponent* InstigatorCombatant=nullptr;
@@ -56,8 +62,36 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite,Category="Bullet")
 	FOmegaCustomScriptedEffects ImpactEffects;
+
+	// Pooling
+
+	//Keep this bullet after impact, stop or life span end and reuse it for the next spawn instead of destroying it.
+	UPROPERTY(EditDefaultsOnly, Category="Bullet|Pool")
+	bool bUsePool = false;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bullet|Pool", meta=(EditCondition="bUsePool"))
+	int32 MaxPooledBullets = 64;
+
+	// Data
+
+	//Simulate this bullet as data without spawning an actor. Uses the speed, gravity, sphere radius and collision of this class. OnImpact and OnBulletActivated are not called.
+	UPROPERTY(EditDefaultsOnly, Category="Bullet|Data")
+	bool bRunAsData = false;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bullet|Data", meta=(EditCondition="bRunAsData"))
+	float DataBulletLifetime = 5.0;
+
+	void Native_SetPooledActive(bool bActive);
 	
 private:
+	bool bBulletActive = true;
+	
+
+	UFUNCTION()
+	void local_onProjectileStop(const FHitResult& ImpactResult);
+
+	void local_releaseOrDestroy();
+
 	UFUNCTION()
 	void local_spawnCue(TSubclassOf<AOmegaGameplayCue> cue);
 	
@@ -167,6 +167,12 @@ public:
 	//Should only one of this effect be allowed at a time?
 	EOmegaEffectReplacement SingletonStatus;
 
+	//Run this effect as data stored on the combatant instead of spawning an actor. An actor is still spawned if the class uses a volume, a popup, components, Blueprint events or a Blueprint damage formula.
+	UPROPERTY(EditDefaultsOnly, Category="Effect")
+	bool bRunAsData = false;
+
+	static bool CanRunAsData(TSubclassOf<AOmegaGameplayEffect> EffectClass);
+
 	UFUNCTION(BlueprintImplementableEvent, Category = "Ω|Gameplay|Effects")
 	void OnAttributeDamaged(UCombatantComponent* Combatant, UOmegaAttribute* Attribute, float FinalDamage, class UCombatantComponent* InstigatorCombatant, UOmegaDamageType* DamageType, FHitResult Hit);
 	
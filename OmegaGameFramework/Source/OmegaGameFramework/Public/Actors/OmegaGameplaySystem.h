@@ -54,6 +54,7 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Destroyed() override;
 	virtual bool GetQueuedQueryValue_Implementation(FGameplayTag Tag, UObject* Context=nullptr) override { return true; };
 public:	
@@ -98,6 +99,15 @@ public:
 
 	UPROPERTY(BlueprintAssignable)
 	FOnNotify OnSystemNotify;
+
+	//If set, the Queued Delay state is only read on activation, on shutdown start and when RefreshQueuedDelay is called.
+	//Clear it for systems whose Get Queued Delay Active/Tags change without calling RefreshQueuedDelay, so they are polled instead.
+	UPROPERTY(EditDefaultsOnly,BlueprintReadOnly,Category="Queued Delay")
+	bool bPushQueuedDelay=true;
+
+	//Pushes the current Queued Delay state of this system. Call this whenever GetQueuedDelayActive or GetQueuedDelayTags would return something new.
+	UFUNCTION(BlueprintCallable,Category="Omega|GameplaySystem")
+	void RefreshQueuedDelay();
 	//---------------------------------------------------------------------
 	// RESTART
 	//---------------------------------------------------------------------
@@ -54,8 +54,75 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAddedAsTarget, UCombatantComponen
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRemovedAsTarget, UCombatantComponent*, Instigator);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnActiveTargetChanged, UCombatantComponent*, ActiveTarget, bool, Valid);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCombatantNotify, UCombatantComponent*, Combatant, FName, Notify, const FString&, Flag);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDataEffectTriggered, UCombatantComponent*, Combatant, TSubclassOf<AOmegaGameplayEffect>, EffectClass, float, DamageValue);
 
 
+// One hit of a batched damage application.
+USTRUCT(BlueprintType)
+struct FOmegaDamageRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Damage")
+	UCombatantComponent* Target = nullptr;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Damage")
+	UOmegaAttribute* Attribute = nullptr;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Damage")
+	float BaseDamage = 0.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Damage")
+	UOmegaDamageType* DamageType = nullptr;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Damage")
+	FHitResult Hit;
+};
+
+// An effect instance that lives on the combatant without spawning an effect actor. Used for effect classes that can run as data.
+USTRUCT(BlueprintType)
+struct FOmegaDataEffect
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	int32 EffectId = INDEX_NONE;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	TSubclassOf<AOmegaGameplayEffect> EffectClass;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	UCombatantComponent* Instigator = nullptr;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	UObject* Context = nullptr;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	float Power = 1.0;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	FGameplayTag EffectCategory;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	FGameplayTagContainer EffectTags;
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	float TimeElapsed = 0.0;
+	//Time until the effect triggers and is removed. Negative if the effect has no timed lifetime.
+	UPROPERTY(BlueprintReadOnly, Category="Effect")
+	float Lifetime = -1.0;
+};
+
+// Modifier values of every modifier source flattened into one bucket per attribute.
+// Increments and multipliers are summed per attribute, so applying them is a single lookup.
+USTRUCT()
+struct FOmegaAttributeModifierTable
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<UOmegaAttribute*> Attributes;
+	UPROPERTY(Transient)
+	TArray<float> Increments;
+	UPROPERTY(Transient)
+	TArray<float> Multipliers;
+
+	TMap<UOmegaAttribute*, int32> AttributeIndices;
+
+	void Reset();
+	void AddModifiers(const TArray<FOmegaAttributeModifier>& Modifiers);
+	float Apply(UOmegaAttribute* Attribute, float BaseValue) const;
+};
+
 #define PrintError(ErrorText) \
 	(GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Red, ErrorText))
 
@@ -123,9 +190,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combatant")
 	class UOmegaAttributeSet* AttributeSet;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combatant")
+	//Set through SetLevel or SetCombatantLevel so the cached attribute values are cleared.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter=SetLevel, Category = "Combatant")
 	int32 Level = 1;
 
+	UFUNCTION(BlueprintSetter)
+	void SetLevel(int32 NewLevel);
+
 	//Forcibly Override whatever the max attributes values found in the "AttributeSet" 
 	UPROPERTY(EditAnywhere, Category = "Combatant")
 	TMap<UOmegaAttribute*, float>  OverrideMaxAttributes;
@@ -150,6 +221,14 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Attributes", meta = (AdvancedDisplay = "Instigator, Context, DamageType, Hit"))
 	float ApplyAttributeDamage(class UOmegaAttribute* Attribute, float BaseDamage, class UCombatantComponent* Instigator, UObject* Context, UOmegaDamageType* DamageType, FHitResult Hit);
+
+	//Applies many hits at once. Modifiers are gathered once per target, values are applied before any delegate fires, and each target creates at most one effect per reaction. Returns the final damage of each record.
+	static TArray<float> Native_ApplyAttributeDamageBatch(const TArray<FOmegaDamageRecord>& Records, UCombatantComponent* Instigator, UObject* Context);
+
+private:
+	float local_ResolveDamage(UOmegaAttribute* Attribute, float BaseDamage, UCombatantComponent* Instigator, UObject* Context, UOmegaDamageType* DamageType, const TArray<UObject*>& DamageModifiers, UOmegaDamageTypeReactionAsset*& OutReaction);
+	void local_DeductAttributeValue(UOmegaAttribute* Attribute, float FinalDamage);
+public:
 	
 	UFUNCTION(BlueprintPure, Category = "Attributes")
 	void GetAttributeValue(class UOmegaAttribute* Attribute, float& CurrentValue, float& MaxValue);
@@ -176,9 +255,12 @@ public:
 	void InitializeAttributes();
 
 	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes", AdvancedDisplay)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter=SetAttributeLevels, Category = "Attributes", AdvancedDisplay)
 	TMap<class UOmegaAttribute*, int32> AttributeLevels;
 
+	UFUNCTION(BlueprintSetter)
+	void SetAttributeLevels(TMap<UOmegaAttribute*, int32> NewLevels);
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes", AdvancedDisplay)
 	FGameplayTag AttributeValueCategory;
 
@@ -198,6 +280,30 @@ public:
 
 	UFUNCTION(BlueprintPure, Category="Attributes")
 	TArray<FOmegaAttributeModifier> GetAllModifierValues();
+
+	//Caches the modified max value of each attribute until a modifier source, level, attribute set or override changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes", AdvancedDisplay)
+	bool bCacheAttributeValues = true;
+
+	//Clears the cached attribute values. Call this if a modifier source changes its values without being re-registered.
+	UFUNCTION(BlueprintCallable, Category="Attributes")
+	void InvalidateAttributeCache();
+
+	UPROPERTY(Transient)
+	TMap<class UOmegaAttribute*, float> CachedMaxAttributeValues;
+
+	//Returns the flattened values of every modifier source. Rebuilt only after a modifier source changes, or once per frame if attribute values are not cached.
+	const FOmegaAttributeModifierTable& GetAttributeModifierTable();
+
+private:
+	void local_ClearCachedAttributeValues() { CachedMaxAttributeValues.Empty(); }
+
+	UPROPERTY(Transient)
+	FOmegaAttributeModifierTable ModifierTable;
+	bool bModifierTableDirty = true;
+	uint64 ModifierTableFrame = 0;
+
+public:
 	
 	//----------------------------------------------------------------------------------------------------------------//
 	// -- DamageReactions -- 
@@ -320,10 +426,42 @@ public:
 	////////// -- General -- ////////
 	///////////////////////////////////
 
-	//Refreshes all visible combatnat related values, primarily in widgets.
+	//Refreshes all visible combatnat related values, primarily in widgets. Updates are batched and flushed once per frame.
 	UFUNCTION(BlueprintCallable, Category = "Combatant", DisplayName="Refresh")
 	void Update();
 
+	//Immediately pushes pending updates to the registered widgets.
+	UFUNCTION(BlueprintCallable, Category = "Combatant|Widget")
+	void FlushWidgetUpdates();
+
+	//Registers a widget implementing the Combatant widget interface to receive this combatant's updates, and refreshes it at once.
+	UFUNCTION(BlueprintCallable, Category = "Combatant|Widget")
+	void RegisterCombatantWidget(UUserWidget* Widget);
+
+	//Registers a combatant widget with the combatant its Get Combatant Component returns. Omega widgets call this on construct and when their source asset changes; call it from other widgets when their combatant is set.
+	UFUNCTION(BlueprintCallable, Category = "Omega|Combatant|Widget")
+	static void BindCombatantWidget(UUserWidget* Widget);
+
+	UFUNCTION(BlueprintCallable, Category = "Combatant|Widget")
+	void UnregisterCombatantWidget(UUserWidget* Widget);
+
+	//Legacy: searches every widget on each flush for combatant widgets whose Get Combatant Component returns this combatant, and registers them.
+	//Only needed for widgets that neither derive from an Omega widget nor call Bind Combatant Widget.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant|Widget", AdvancedDisplay)
+	bool bScanForCombatantWidgets = false;
+
+private:
+	UPROPERTY() TArray<TWeakObjectPtr<UUserWidget>> REF_CombatantWidgets;
+	//Widgets found by the scan since the last flush, which get every attribute instead of only the changed ones.
+	UPROPERTY() TArray<TWeakObjectPtr<UUserWidget>> REF_NewCombatantWidgets;
+	//Attribute values (current, max) as of the last flush.
+	UPROPERTY(Transient) TMap<UOmegaAttribute*, FVector2D> REF_PushedAttributeValues;
+	bool bWidgetUpdatePending = false;
+
+	void local_PushAttributeToWidget(UUserWidget* Widget, UOmegaAttribute* Attribute, float Value, float MaxValue);
+	void local_RefreshCombatantWidget(UUserWidget* Widget);
+public:
+
 	//Tries to get the owning actor as a Pawn.
 	UFUNCTION(BlueprintPure, Category="Combatant")
 	APawn* GetOwnerPawn();
@@ -505,6 +643,34 @@ public:
     
 	UFUNCTION(BlueprintCallable, Category = "Effects")
 	void RemoveEffectsWithTags(FGameplayTagContainer EffectTags);
+
+	//-----Data Effects-----//
+	// Effects of classes that run as data are stored here instead of being spawned as actors.
+	UPROPERTY()
+	TArray<FOmegaDataEffect> DataEffects;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnDataEffectTriggered OnDataEffectTriggered;
+
+	UFUNCTION(BlueprintPure, Category = "Effects")
+	TArray<FOmegaDataEffect> GetDataEffectsWithTags(FGameplayTagContainer Tags);
+
+	UFUNCTION(BlueprintPure, Category = "Effects")
+	TArray<FOmegaDataEffect> GetDataEffectsOfCategory(FGameplayTag CategoryTag);
+
+	UFUNCTION(BlueprintCallable, Category = "Effects")
+	void RemoveDataEffectsWithTags(FGameplayTagContainer EffectTags);
+
+	// Advances the lifetimes of timed data effects and triggers the expired ones. Returns false once no timed effects remain.
+	bool Native_AdvanceDataEffects(float DeltaTime);
+
+private:
+	void local_AddDataEffect(TSubclassOf<AOmegaGameplayEffect> EffectClass, float Power, UCombatantComponent* Instigator, const FGameplayTagContainer& AddedTags, UObject* Context);
+	void local_TriggerDataEffect(int32 EffectId, bool bRemove);
+	void local_RemoveDataEffectAt(int32 Index);
+
+	int32 NextDataEffectId = 0;
+public:
 	
 	//----------------------------------------------------------------------------------------------------------------//
 	// -- TARGETING -- 
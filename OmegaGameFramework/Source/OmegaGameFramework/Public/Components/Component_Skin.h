@@ -9,6 +9,9 @@
 #include "Styling/SlateBrush.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Misc/GeneralDataObject.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectKey.h"
 #include "Component_Skin.generated.h"
 
 USTRUCT(Blueprintable,BlueprintType)
@@ -124,14 +127,122 @@ public:
 };
 
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnOmegaSkinMerged, USkeletalMesh*, MergedMesh);
+
+//Skeleton plus the ordered meshes merged onto it. Order is kept since it decides the section order of the merged mesh.
+struct FOmegaSkinMergeKey
+{
+	TObjectKey<USkeleton> Skeleton;
+	TArray<TObjectKey<USkeletalMesh>> Meshes;
+
+	bool operator==(const FOmegaSkinMergeKey& Other) const
+	{
+		return Skeleton==Other.Skeleton && Meshes==Other.Meshes;
+	}
+
+	friend uint32 GetTypeHash(const FOmegaSkinMergeKey& Key)
+	{
+		uint32 Hash = GetTypeHash(Key.Skeleton);
+		for(const TObjectKey<USkeletalMesh>& TempMesh : Key.Meshes)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(TempMesh));
+		}
+		return Hash;
+	}
+};
+
+struct FOmegaSkinMergeEntry
+{
+	TObjectPtr<USkeletalMesh> Mesh = nullptr;
+	int32 RefCount = 0;
+	int64 Bytes = 0;
+	double LastUsedTime = 0.0;
+};
+
+struct FOmegaSkinMergeRequest
+{
+	TObjectPtr<USkeleton> Skeleton = nullptr;
+	TArray<TObjectPtr<USkeletalMesh>> Meshes;
+	TArray<TFunction<void(USkeletalMesh*)>> Callbacks;
+};
+
+//Caches merged skin meshes so skins sharing the same parts share one merged mesh.
+//Skins hold a reference to the mesh they use. Unused meshes are kept until the cache goes over SkinMergeCacheBudgetMB, oldest first.
+UCLASS(DisplayName="Omega Subsystem: Skin Merge")
+class OMEGAGAMEFRAMEWORK_API UOmegaSkinMergeSubsystem : public UEngineSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return PendingOrder.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UOmegaSkinMergeSubsystem, STATGROUP_Tickables ); }
+	virtual bool IsTickableWhenPaused() const { return true; }
+	virtual bool IsTickableInEditor() const { return true; }
+	// FTickableGameObject End
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	//Merges the meshes without the cache. Used outside of game worlds, where parts can be edited or re-imported at any time.
+	static USkeletalMesh* Native_MergeMeshesUncached(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes);
+
+	//Cached merge of these meshes, or nullptr if it has not been merged yet.
+	USkeletalMesh* Native_FindMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes);
+	//Cached merge of these meshes, merging them now if needed.
+	USkeletalMesh* Native_GetMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes);
+	//Queues the merge for a later frame. Requests for the same meshes share one merge. Calls back at once if already cached.
+	void Native_RequestMergedMesh(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes, TFunction<void(USkeletalMesh*)>&& Callback);
+
+	//Marks a cached mesh as in use so it is never evicted.
+	UFUNCTION(BlueprintCallable,Category="Omega|Skin")
+	void AddMergedMeshReference(USkeletalMesh* Mesh);
+	UFUNCTION(BlueprintCallable,Category="Omega|Skin")
+	void ReleaseMergedMesh(USkeletalMesh* Mesh);
+
+	//Drops every cached mesh that is not in use.
+	UFUNCTION(BlueprintCallable,Category="Omega|Skin")
+	void ClearUnusedMergedMeshes();
+
+	UFUNCTION(BlueprintPure,Category="Omega|Skin")
+	int32 GetMergedMeshCount() const { return MergedMeshes.Num(); }
+
+private:
+	static FOmegaSkinMergeKey local_MakeMergeKey(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes);
+	USkeletalMesh* local_MergeAndCache(const FOmegaSkinMergeKey& Key, USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes);
+	void local_RemoveEntry(const FOmegaSkinMergeKey& Key);
+	void local_TrimToBudget();
+	void local_UpdateStats() const;
+#if WITH_EDITOR
+	//Drops cached merges that use an edited or re-imported skeleton or mesh.
+	void local_OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	FDelegateHandle PropertyChangedHandle;
+#endif
+
+	TMap<FOmegaSkinMergeKey, FOmegaSkinMergeEntry> MergedMeshes;
+	TMap<TObjectKey<USkeletalMesh>, FOmegaSkinMergeKey> MergedMeshKeys;
+	TMap<FOmegaSkinMergeKey, FOmegaSkinMergeRequest> PendingMerges;
+	TArray<FOmegaSkinMergeKey> PendingOrder;
+	int64 CachedBytes = 0;
+};
+
 UCLASS()
 class OMEGAGAMEFRAMEWORK_API UOmegaSkinFunctions : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
 public:
+	//Merged meshes are cached, so merging the same meshes again returns the same mesh.
 	UFUNCTION(BlueprintCallable, Category="Omega", DisplayName="Merge Meshes (Omega)")
 	static USkeletalMesh* MergeMeshes_Omega(TArray<USkeletalMesh*> Meshes, USkeletalMesh* BaseMesh);
 
+	//Merges on a later frame so spawning does not stall. Calls back at once if the merge is already cached.
+	UFUNCTION(BlueprintCallable, Category="Omega", DisplayName="Merge Meshes Async (Omega)")
+	static void MergeMeshesAsync_Omega(TArray<USkeletalMesh*> Meshes, USkeletalMesh* BaseMesh, const FOnOmegaSkinMerged& OnMerged);
+
 	UFUNCTION(BlueprintCallable, Category="Omega", DisplayName="Merge Meshe Components (Omega)")
 	static USkeletalMesh* MergeComponentMeshes_Omega(TArray<USkeletalMeshComponent*> Meshes, USkeletalMesh* BaseMesh);
 
@@ -169,6 +280,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Skin")
 	bool bMerge;
 
+	//Merges on a later frame instead of stalling the spawn. Until then the parts follow the master mesh unmerged.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Skin", meta=(EditCondition="bMerge"))
+	bool bAsyncMerge;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Skin")
 	bool bForceFollowMasterComponent;
 
@@ -178,9 +293,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Instanced, Category="Skin")
 	TArray<USkinModifier*> SkinModifiers;
 
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 	void TrySetAnimation(USkeletalMeshComponent* TargetMesh);
 	UFUNCTION() void local_applyModifiers(USkeletalMeshComponent* MeshComp);
+	void local_applyMergedMesh(USkeletalMeshComponent* TargetMesh, USkeletalMesh* MergedMesh);
+	//Swaps the cached merged mesh this skin holds a reference to
+	void local_holdMergedMesh(USkeletalMesh* MergedMesh);
+	UPROPERTY() USkeletalMesh* held_MergedMesh;
+	//Bumped on every build so a late async merge from an older build is ignored
+	int32 merge_Serial=0;
 public:
 	UFUNCTION(BlueprintNativeEvent, Category="Omega")
 	USkeletalMeshComponent* GetCompressedMeshComponent();
@@ -32,6 +32,18 @@ public:
 	UFUNCTION(BlueprintImplementableEvent)
 	bool ShouldTargetActFirst(UCombatantComponent* TargetCombatant, UCombatantComponent* ComparedCombatant);
 
+	//Sort the turn order by the keys from GetTurnOrderKeys instead of ShouldTargetActFirst. Keys are fetched once per combatant and sorted natively.
+	UPROPERTY(EditAnywhere, Category="TurnManager")
+	bool bUseTurnOrderKeys = false;
+
+	//If false, combatants with lower keys act first.
+	UPROPERTY(EditAnywhere, Category="TurnManager", meta=(EditCondition="bUseTurnOrderKeys"))
+	bool bTurnOrderKeysDescending = false;
+
+	//Returns the turn order keys of a combatant. Later keys are only compared when the earlier keys are equal.
+	UFUNCTION(BlueprintNativeEvent, Category="TurnManager")
+	TArray<float> GetTurnOrderKeys(UCombatantComponent* Combatant);
+
 	UFUNCTION(BlueprintImplementableEvent)
 	bool FailBeingTurn(FString& FailReason);
 
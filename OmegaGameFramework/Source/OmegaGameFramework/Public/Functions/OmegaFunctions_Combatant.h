@@ -75,6 +75,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Combat",DisplayName="Ω Apply Gameplay Effects (from Asset)")
 	static void ApplyEffectFromAsset(UCombatantComponent* Combatant, UCombatantComponent* Instigator, UObject* Asset);
 
+	//Applies damage to many targets in one pass, e.g. for area or chain attacks. Returns the final damage of each record.
+	UFUNCTION(BlueprintCallable, Category="Combat", meta=(AdvancedDisplay = "Context"),DisplayName="Ω Apply Attribute Damage (Batch)")
+	static TArray<float> ApplyAttributeDamageBatch(const TArray<FOmegaDamageRecord>& Records, UCombatantComponent* Instigator, UObject* Context);
+
 	UFUNCTION(BlueprintPure, Category="Combat", meta = (WorldContext = "WorldContextObject")) 
 	static UCombatantComponent* GetPlayerCombatant(const UObject* WorldContextObject, int32 Index);
 
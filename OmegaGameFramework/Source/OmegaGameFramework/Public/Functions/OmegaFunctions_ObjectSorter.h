@@ -17,7 +17,36 @@ class UOmegaObjectSorterFunctions : public UBlueprintFunctionLibrary
 public:
 	UFUNCTION(BlueprintCallable, Category="Omega|ObjectSorter", meta=(DeterminesOutputType=OutputClass, AdvancedDisplay="OutputClass"))
 	static TArray<UObject*> SortObjectArray(TArray<UObject*> InObjects, UOmegaObjectSorterAsset* Sorter, TSubclassOf<UObject> OutputClass, UObject* Context=nullptr);
-	
+
+	// Stable sort on keys fetched once per object. Keys are compared in order, so later keys break ties of earlier ones.
+	template<typename T>
+	static void Native_SortByKeys(TArray<T*>& Objects, TFunctionRef<TArray<float>(T*)> GetKeys, bool bDescending)
+	{
+		TArray<TPair<TArray<float>, T*>> KeyedObjects;
+		KeyedObjects.Reserve(Objects.Num());
+		for(T* TempObject : Objects)
+		{
+			KeyedObjects.Emplace(GetKeys(TempObject), TempObject);
+		}
+
+		KeyedObjects.StableSort([bDescending](const TPair<TArray<float>, T*>& A, const TPair<TArray<float>, T*>& B)
+		{
+			const int32 NumKeys = FMath::Min(A.Key.Num(), B.Key.Num());
+			for(int32 i = 0; i < NumKeys; i++)
+			{
+				if(A.Key[i] != B.Key[i])
+				{
+					return bDescending ? A.Key[i] > B.Key[i] : A.Key[i] < B.Key[i];
+				}
+			}
+			return bDescending ? A.Key.Num() > B.Key.Num() : A.Key.Num() < B.Key.Num();
+		});
+
+		for(int32 i = 0; i < KeyedObjects.Num(); i++)
+		{
+			Objects[i] = KeyedObjects[i].Value;
+		}
+	}
 };
 
 UCLASS(EditInlineNew, Blueprintable, BlueprintType, CollapseCategories)
@@ -36,6 +65,18 @@ public:
 	UFUNCTION(BlueprintImplementableEvent,Category="Omega|ObjectSorter")
 	bool ShouldCheckedObjectSortFirst(UObject* CheckedObject, UObject* ComparedObject, UObject* Context);
 
+	//Sort by the keys from GetObjectSortKeys instead of ShouldCheckedObjectSortFirst. Keys are fetched once per object and sorted natively.
+	UPROPERTY(EditAnywhere, Category="Omega|ObjectSorter")
+	bool bUseSortKeys = false;
+
+	//If false, objects with lower keys sort first.
+	UPROPERTY(EditAnywhere, Category="Omega|ObjectSorter", meta=(EditCondition="bUseSortKeys"))
+	bool bSortKeysDescending = false;
+
+	//Returns the sort keys of an object. Later keys are only compared when the earlier keys are equal.
+	UFUNCTION(BlueprintNativeEvent,Category="Omega|ObjectSorter")
+	TArray<float> GetObjectSortKeys(UObject* Object, UObject* Context);
+
 };
 
 
@@ -0,0 +1,193 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/RingBuffer.h"
+
+// Fixed capacity log. Once full, each new entry overwrites the oldest one.
+// Every entry is filed under a key (category) so entries of one key can be read without scanning the whole log.
+// Indexes are oldest-first, for both the full log and a single key.
+template<typename EntryType, typename KeyType>
+class TOmegaRingLog
+{
+public:
+
+	explicit TOmegaRingLog(int32 InCapacity = 256)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	int32 GetCapacity() const { return Capacity; }
+	int32 Num() const { return Entries.Num(); }
+	bool IsFull() const { return Entries.Num() >= Capacity; }
+
+	// Total entries ever added, including evicted ones.
+	int64 GetTotalAdded() const { return NextSeq; }
+
+	// Resizing keeps the newest entries.
+	void SetCapacity(int32 NewCapacity)
+	{
+		NewCapacity = FMath::Max(NewCapacity, 1);
+		if(NewCapacity == Capacity)
+		{
+			return;
+		}
+		const int32 Kept = FMath::Min(Entries.Num(), NewCapacity);
+		const int32 Skipped = Entries.Num() - Kept;
+
+		TArray<EntryType> NewEntries;
+		TArray<KeyType> NewKeys;
+		NewEntries.Reserve(NewCapacity);
+		NewKeys.Reserve(NewCapacity);
+		for(int32 i = Skipped; i < Entries.Num(); i++)
+		{
+			const int32 Slot = GetSlot(i);
+			NewEntries.Add(MoveTemp(Entries[Slot]));
+			NewKeys.Add(MoveTemp(EntryKeys[Slot]));
+		}
+		Entries = MoveTemp(NewEntries);
+		EntryKeys = MoveTemp(NewKeys);
+		Capacity = NewCapacity;
+		Head = Entries.Num() % Capacity;
+		RebuildKeyIndex();
+	}
+
+	// Returns true if the oldest entry was evicted to make room. It is moved into OutEvicted if given.
+	bool Add(EntryType&& Entry, const KeyType& Key, EntryType* OutEvicted = nullptr, KeyType* OutEvictedKey = nullptr)
+	{
+		bool bEvicted = false;
+		if(IsFull())
+		{
+			// Head is the oldest slot when full. Its sequence number is always first in its key's index.
+			KeyType& OldKey = EntryKeys[Head];
+			if(TRingBuffer<int64>* OldIndex = KeyIndex.Find(OldKey))
+			{
+				OldIndex->PopFront();
+				if(OldIndex->IsEmpty())
+				{
+					KeyIndex.Remove(OldKey);
+				}
+			}
+			if(OutEvicted)
+			{
+				*OutEvicted = MoveTemp(Entries[Head]);
+			}
+			if(OutEvictedKey)
+			{
+				*OutEvictedKey = MoveTemp(OldKey);
+			}
+			Entries[Head] = MoveTemp(Entry);
+			EntryKeys[Head] = Key;
+			bEvicted = true;
+		}
+		else
+		{
+			Entries.Add(MoveTemp(Entry));
+			EntryKeys.Add(Key);
+		}
+		Head = (Head + 1) % Capacity;
+		KeyIndex.FindOrAdd(Key).Add(NextSeq++);
+		return bEvicted;
+	}
+
+	void Empty()
+	{
+		Entries.Empty();
+		EntryKeys.Empty();
+		KeyIndex.Empty();
+		Head = 0;
+	}
+
+	const EntryType& operator[](int32 Index) const { return Entries[GetSlot(Index)]; }
+	EntryType& operator[](int32 Index) { return Entries[GetSlot(Index)]; }
+
+	int32 NumOfKey(const KeyType& Key) const
+	{
+		const TRingBuffer<int64>* Index = KeyIndex.Find(Key);
+		return Index ? Index->Num() : 0;
+	}
+
+	const EntryType& GetOfKey(const KeyType& Key, int32 Index) const
+	{
+		return Entries[GetSlotOfSeq(KeyIndex.FindChecked(Key)[Index])];
+	}
+
+	// Visits entries oldest-first. Return false from the callback to stop.
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for(int32 i = 0; i < Entries.Num(); i++)
+		{
+			if(!Func(Entries[GetSlot(i)]))
+			{
+				return;
+			}
+		}
+	}
+
+	template<typename FuncType>
+	void ForEachOfKey(const KeyType& Key, FuncType&& Func) const
+	{
+		if(const TRingBuffer<int64>* Index = KeyIndex.Find(Key))
+		{
+			for(int32 i = 0; i < Index->Num(); i++)
+			{
+				if(!Func(Entries[GetSlotOfSeq((*Index)[i])]))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	// Page of up to Count entries starting at Start. A negative Count reads to the end.
+	template<typename FuncType>
+	void ForEachInPage(int32 Start, int32 Count, FuncType&& Func) const
+	{
+		const int32 End = Count < 0 ? Entries.Num() : FMath::Min(Entries.Num(), Start + Count);
+		for(int32 i = FMath::Max(Start, 0); i < End; i++)
+		{
+			Func(Entries[GetSlot(i)]);
+		}
+	}
+
+	template<typename FuncType>
+	void ForEachOfKeyInPage(const KeyType& Key, int32 Start, int32 Count, FuncType&& Func) const
+	{
+		if(const TRingBuffer<int64>* Index = KeyIndex.Find(Key))
+		{
+			const int32 End = Count < 0 ? Index->Num() : FMath::Min(Index->Num(), Start + Count);
+			for(int32 i = FMath::Max(Start, 0); i < End; i++)
+			{
+				Func(Entries[GetSlotOfSeq((*Index)[i])]);
+			}
+		}
+	}
+
+	// Raw storage in slot order, for reference collection.
+	TArray<EntryType>& GetStorage() { return Entries; }
+
+private:
+
+	int32 GetOldestSlot() const { return IsFull() ? Head : 0; }
+	int32 GetSlot(int32 Index) const { return (GetOldestSlot() + Index) % Capacity; }
+	int32 GetSlotOfSeq(int64 Seq) const { return GetSlot(static_cast<int32>(Seq - (NextSeq - Entries.Num()))); }
+
+	void RebuildKeyIndex()
+	{
+		KeyIndex.Empty();
+		const int64 FirstSeq = NextSeq - Entries.Num();
+		for(int32 i = 0; i < Entries.Num(); i++)
+		{
+			KeyIndex.FindOrAdd(EntryKeys[GetSlot(i)]).Add(FirstSeq + i);
+		}
+	}
+
+	TArray<EntryType> Entries;
+	TArray<KeyType> EntryKeys;
+	TMap<KeyType, TRingBuffer<int64>> KeyIndex;
+	int32 Capacity = 0;
+	int32 Head = 0;
+	int64 NextSeq = 0;
+};
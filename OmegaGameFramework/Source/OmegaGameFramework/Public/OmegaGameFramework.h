@@ -8,6 +8,7 @@
 #include "Styling/SlateStyle.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(OmegaGameFramework, All, All);
+DECLARE_STATS_GROUP(TEXT("Omega Game Framework"), STATGROUP_Omega, STATCAT_Advanced);
 
 class FOmegaGameFrameworkModule : public IModuleInterface
 {
@@ -71,6 +71,9 @@ public:
 	FSoftClassPath GlobalSaveClass;
 	UPROPERTY(EditAnywhere, config, Category = "Save")
 	FString GlobalSaveName = "global";
+	//Compresses game saves before writing them to disk. Uncompressed saves are written in the engine's plain format and can still be loaded either way.
+	UPROPERTY(EditAnywhere, config, Category = "Save")
+	bool bCompressSaveGames = false;
 	UPROPERTY()
     TArray<FString> LuaFields_AutoSavedToGlobal;
 
@@ -131,6 +134,17 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Dynamic Camera", meta = (MetaClass = "OmegaDynamicCamera"))
 	FSoftClassPath DynamicCameraClass;
 
+	//########################################################
+	//Skins
+	//########################################################
+	//Memory that merged skin meshes no skin is using may keep in the merge cache. Meshes in use are never evicted.
+	UPROPERTY(EditAnywhere, config, Category = "Skins", meta=(ClampMin=0))
+	int32 SkinMergeCacheBudgetMB = 128;
+
+	//How many queued async skin merges run each frame.
+	UPROPERTY(EditAnywhere, config, Category = "Skins", meta=(ClampMin=1))
+	int32 MaxSkinMergesPerFrame = 1;
+
 	//########################################################
 	//Zones
 	//########################################################
@@ -144,6 +158,29 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Zones")
 	FGameplayTag ZoneBGMSlot;
 
+	//How many streamed levels of a zone may load or unload at once.
+	UPROPERTY(EditAnywhere, config, Category = "Zones", meta=(ClampMin=1))
+	int32 MaxConcurrentZoneStreams = 4;
+
+	//Memory that levels prefetched near zone transits may use, by package size on disk. 0 disables prefetching.
+	UPROPERTY(EditAnywhere, config, Category = "Zones", meta=(ClampMin=0))
+	int32 ZonePrefetchBudgetMB = 256;
+
+	//########################################################
+	//Log
+	//########################################################
+	//Entries kept in the Game Manager's gameplay log. Oldest entries are dropped past this.
+	UPROPERTY(EditAnywhere, config, Category = "Log")
+	int32 GameplayLogCapacity = 512;
+
+	//Messages kept in the Message Subsystem's log. Oldest messages are dropped past this.
+	UPROPERTY(EditAnywhere, config, Category = "Log")
+	int32 MessageLogCapacity = 256;
+
+	//Append dropped gameplay log entries to Saved/Logs/OmegaGameplayLog.log so the full history is kept on disk.
+	UPROPERTY(EditAnywhere, config, Category = "Log")
+	bool bArchiveEvictedGameplayLog = false;
+
 	//########################################################
 	//Mods
 	//########################################################
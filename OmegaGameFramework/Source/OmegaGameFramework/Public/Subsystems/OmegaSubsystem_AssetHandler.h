@@ -8,7 +8,25 @@
 #include "Subsystems/EngineSubsystem.h"
 #include "OmegaSubsystem_AssetHandler.generated.h"
 
+USTRUCT()
+struct FOmegaSortedAssetBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<UObject*> Assets;
+};
+
+//Index keys an asset was filed under when it was registered, so it can be removed even if its tags change later.
+USTRUCT()
+struct FOmegaSortedAssetRecord
+{
+	GENERATED_BODY()
 
+	UPROPERTY() int32 NumLabels = 0;
+	UPROPERTY() FGameplayTag Category;
+	UPROPERTY() FGameplayTagContainer Tags;
+	UPROPERTY() bool bHasTagInterface = false;
+};
 
 UCLASS()
 class OMEGAGAMEFRAMEWORK_API UOmegaSubsystem_AssetHandler : public UEngineSubsystem
@@ -31,8 +49,24 @@ public:
 	void Register_SortedAsset(UObject* Asset, FString Name, bool bOverride);
 
 	UPROPERTY() TMap<FString, UObject*> SortedAssets;
-private:
+
+	//Indexed queries. Each returns unique assets and runs in time proportional to the matched buckets.
+	//A null class returns nothing from OfClass, and matches every asset in OfCategory and WithTags.
+	TArray<UObject*> Native_GetSortedAssets_OfClass(UClass* Class) const;
+	TArray<UObject*> Native_GetSortedAssets_OfCategory(const FGameplayTag& CategoryTag, UClass* Class) const;
+	TArray<UObject*> Native_GetSortedAssets_WithTags(const FGameplayTagContainer& Tags, UClass* Class) const;
 	
+private:
+	//Assets by exact class
+	UPROPERTY() TMap<UClass*, FOmegaSortedAssetBucket> REF_AssetsByClass;
+	//Assets by category tag and every parent of it
+	UPROPERTY() TMap<FGameplayTag, FOmegaSortedAssetBucket> REF_AssetsByCategory;
+	//Assets by exact gameplay tag
+	UPROPERTY() TMap<FGameplayTag, FOmegaSortedAssetBucket> REF_AssetsByTag;
+	UPROPERTY() TMap<UObject*, FOmegaSortedAssetRecord> REF_AssetRecords;
+
+	void local_IndexAsset(UObject* Asset);
+	void local_UnindexAsset(UObject* Asset);
 };
 
 
@@ -12,6 +12,29 @@
 #include "OmegaSubsystem_DynamicCamera.generated.h"
 
 class UOmegaSaveSubsystem;
+class AOmegaDynamicCamera;
+
+// Everything the master camera takes from its sources, so blending and interpolation never touch components.
+USTRUCT(BlueprintType)
+struct FOmegaDynamicCameraState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FVector Location = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FRotator Rotation = FRotator::ZeroRotator;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") float FieldOfView = 90.0;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") float ArmLength = 0.0;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FVector ArmLocation = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FRotator ArmRotation = FRotator::ZeroRotator;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FVector SocketOffset = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite, Category="Dynamic Camera") FVector TargetOffset = FVector::ZeroVector;
+
+	static FOmegaDynamicCameraState FromCamera(const AOmegaDynamicCamera* Camera);
+	void ApplyTo(AOmegaDynamicCamera* Camera) const;
+
+	// Same easing as VInterpTo/RInterpTo/FInterpTo, applied to every field with one alpha. A speed of 0 snaps.
+	void InterpTo(const FOmegaDynamicCameraState& Target, float DeltaTime, float Speed);
+};
 
 UCLASS(ClassGroup=("Omega Game Framework"), meta=(BlueprintSpawnableComponent))
 class OMEGAGAMEFRAMEWORK_API UDynamicCameraState : public UPrimaryDataAsset
@@ -67,7 +90,11 @@ public:
 
 
 	UPROPERTY() AOmegaDynamicCamera* override_camera;
+	// The override camera if it is set and active. Every source query goes through this so they agree.
+	AOmegaDynamicCamera* local_GetActiveOverrideCamera() const;
 	UPROPERTY() TArray<AOmegaDynamicCamera*> source_cameras;
+	// Registered cameras that are active, highest priority first. Kept sorted as cameras register or change.
+	UPROPERTY() TArray<AOmegaDynamicCamera*> active_cameras;
 	UPROPERTY() AOmegaDynamicCamera* master_camera;
 	UPROPERTY() float last_delta;
 	
@@ -80,6 +107,12 @@ public:
 	AOmegaDynamicCamera* GetSourceCamera();
 	
 	UFUNCTION() void SetCameraSourceRegistered(AOmegaDynamicCamera* Camera, bool IsActive);
+	//Re-sorts a camera after its priority or active state changed.
+	void Native_UpdateSourceCamera(AOmegaDynamicCamera* Camera);
+
+	//State of the override camera or the top camera, blended with peers at the same priority when they opted in.
+	UFUNCTION(BlueprintPure, Category="Dynamic Camera")
+	bool GetBlendedSourceState(FOmegaDynamicCameraState& State, float& InterpSpeed);
 	
 	UFUNCTION(BlueprintCallable, Category="Dynamic Camera")
 	void SetDynamicCameraActive(bool IsActive);
@@ -125,6 +158,8 @@ protected:
 	TArray<UObject*> GetValidSources();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	UOmegaDynamicCameraSubsystem* GetCameraSubsystem() const;
 
 	UPROPERTY()
 	UOmegaDynamicCameraSubsystem* REF_Subsystem=nullptr;
@@ -142,10 +177,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="DynamicCamera")
 	UCameraComponent* comp_camera;
 	
-	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera")
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,BlueprintSetter=SetCameraPriority,Category="DynamicCamera")
 	int32 Priority;
-	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera")
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,BlueprintSetter=SetCameraActive,Category="DynamicCamera")
 	bool CameraActive=true;
+	//When set, this camera blends with other opted-in cameras sharing the top priority. Otherwise the most recently activated camera wins ties.
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera")
+	bool bBlendWithPeers=false;
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera",meta=(ClampMin=0,EditCondition="bBlendWithPeers"))
+	float BlendWeight=1.0;
+
+	UFUNCTION(BlueprintSetter)
+	void SetCameraPriority(int32 NewPriority);
+	UFUNCTION(BlueprintSetter)
+	void SetCameraActive(bool bActive);
 	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera")
 	float InterpSpeed=10.0;
 	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="DynamicCamera")
@@ -0,0 +1,39 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+// Advances the lifetimes of all data effects in the world in one batched update, instead of one ticking actor per effect.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "OmegaSubsystem_Effects.generated.h"
+
+class UCombatantComponent;
+
+UCLASS(DisplayName="Omega Subsystem: Effects")
+class OMEGAGAMEFRAMEWORK_API UOmegaEffectSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return DataEffectCombatants.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UOmegaEffectSubsystem, STATGROUP_Tickables ); }
+	virtual bool IsTickableWhenPaused() const { return false; }
+	virtual bool IsTickableInEditor() const { return false; }
+	// FTickableGameObject End
+
+	virtual void Deinitialize() override;
+
+	// Adds a combatant with timed data effects to the batched update. It is dropped again once it has none left.
+	void Native_RegisterDataEffects(UCombatantComponent* Combatant);
+	void Native_UnregisterDataEffects(UCombatantComponent* Combatant);
+
+private:
+	UPROPERTY()
+	TArray<UCombatantComponent*> DataEffectCombatants;
+};
@@ -8,6 +8,7 @@
 #include "JsonObjectWrapper.h"
 #include "Misc/OmegaGameMode.h"
 #include "Misc/OmegaUtils_Structs.h"
+#include "Misc/OmegaUtils_RingLog.h"
 #include "OmegaSubsystem_GameManager.generated.h"
 
 class UOmegaSettings;
@@ -30,6 +31,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTaggedGlobalEvent, FGameplayTag,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNewLevel, FString, LevelName, AOmegaGameMode*, GameMode);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFlagStateChange, FString, Flag, bool, NewState);
 
+// Native listeners for one flag or one event. Only woken when that flag or event fires.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOmegaFlagListeners, bool);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOmegaGlobalEventListeners, UObject*);
+
 UCLASS(Category = "OmegaSubsystems|Instance")
 class OMEGAGAMEFRAMEWORK_API UOmegaGameManager : public UGameInstanceSubsystem
 {
@@ -76,6 +81,14 @@ public:
 	
 	UPROPERTY(BlueprintAssignable)
 	FOnTaggedGlobalEvent OnTaggedGlobalEvent;
+
+	FOmegaGlobalEventListeners& Native_OnGlobalEvent(FName Event) { return GlobalEventListeners.FindOrAdd(Event); }
+	FOmegaGlobalEventListeners& Native_OnTaggedGlobalEvent(FGameplayTag Event) { return TaggedGlobalEventListeners.FindOrAdd(Event); }
+
+private:
+	TMap<FName, FOmegaGlobalEventListeners> GlobalEventListeners;
+	TMap<FGameplayTag, FOmegaGlobalEventListeners> TaggedGlobalEventListeners;
+public:
 	
 	//################################################################
 	// FLAGS
@@ -94,6 +107,14 @@ public:
 
 	UPROPERTY(BlueprintAssignable)
 	FOnFlagStateChange OnFlagStateChange;
+
+	FOmegaFlagListeners& Native_OnFlagChanged(FName Flag) { return FlagListeners.FindOrAdd(Flag); }
+
+private:
+	// Index of each active flag in Flags, so flags can be checked, added and removed without searching the array.
+	TMap<FName, int32> FlagIndices;
+	TMap<FName, FOmegaFlagListeners> FlagListeners;
+public:
 	
 	/*
 	// Playtime
@@ -135,6 +156,7 @@ public:
 	// LOG
 	//##################################################################################################################
 
+	// Capacity of the log. Past this the oldest entries are dropped (or archived to disk if enabled in settings).
 	UPROPERTY()
 	int32 MaxLogEntry;
 	
@@ -144,13 +166,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category="OmegaGameManager")
 	void ClearLog();
 	
-	UPROPERTY()
-	TArray<FGameplayLogEntry> LocalLog;
+	TOmegaRingLog<FGameplayLogEntry, FString> LocalLog;
 	
 	UFUNCTION(BlueprintPure, Category="OmegaGameManager")
 	TArray<FString> GetGameplayLog();
 	UFUNCTION(BlueprintPure, Category="OmegaGameManager")
 	TArray<FString> GetGameplayLogOfCategory(const FString& LogCategory);
+
+	// Oldest-first page of the log. A Count of -1 reads to the end.
+	UFUNCTION(BlueprintPure, Category="OmegaGameManager")
+	TArray<FString> GetGameplayLogPage(int32 Start, int32 Count, int32& TotalEntries);
+	UFUNCTION(BlueprintPure, Category="OmegaGameManager")
+	TArray<FString> GetGameplayLogOfCategoryPage(const FString& LogCategory, int32 Start, int32 Count, int32& TotalEntries);
+
+	// Leave the category empty to count the whole log.
+	UFUNCTION(BlueprintPure, Category="OmegaGameManager")
+	int32 GetGameplayLogCount(const FString& LogCategory) const { return LogCategory.IsEmpty() ? LocalLog.Num() : LocalLog.NumOfKey(LogCategory); }
+
+	// Writes any pending evicted entries to the archive file.
+	void FlushGameplayLogArchive();
+
+private:
+
+	TArray<FString> PendingLogArchive;
+	FString LogArchivePath;
 	
 
 	
@@ -6,8 +6,84 @@
 #include "UObject/Object.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Engine/DataAsset.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
 #include "OmegaSubsystem_Grid3D.generated.h"
 
+class AOmegaGrid3D_Tile;
+class UOmegaGrid3DTileType;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+// ===============================================================================================================================
+// Pathing
+// ===============================================================================================================================
+
+USTRUCT(BlueprintType)
+struct FOmegaGrid3D_PathParams
+{
+	GENERATED_BODY()
+
+	// Allows stepping between Z layers.
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D Pathing")
+	bool bAllowVertical=true;
+	// Tiles with an occupant cannot be entered (the start tile is always allowed).
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D Pathing")
+	bool bOccupiedBlocksMovement=true;
+	// Tiles with an occupant can still be the goal of a path (e.g. attacking a unit).
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D Pathing")
+	bool bAllowOccupiedGoal=false;
+};
+
+USTRUCT(BlueprintType)
+struct FOmegaGrid3D_TileList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D Pathing")
+	TArray<AOmegaGrid3D_Tile*> Tiles;
+};
+
+USTRUCT(BlueprintType)
+struct FOmegaGrid3D_CoordinateList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D Pathing")
+	TArray<FIntVector> Coordinates;
+};
+
+/**
+ * Compact mirror of a tilemap's tile types used for pathing. Holds no UObject references,
+ * so a copy can safely be queried on a worker thread.
+ */
+struct OMEGAGAMEFRAMEWORK_API FOmegaGrid3D_CostGrid
+{
+	FIntVector GridSize=FIntVector::ZeroValue;
+	// Cost to enter each tile. Negative values are impassable.
+	TArray<float> Costs;
+	TBitArray<> BlocksLineOfEffect;
+	TBitArray<> Occupied;
+	float MinCost=1.0;
+
+	void Reset(FIntVector InGridSize);
+	bool IsValidCoordinate(const FIntVector& Coordinate) const;
+	int32 GetIndex(const FIntVector& Coordinate) const;
+	FIntVector GetCoordinate(int32 Index) const;
+	bool CanEnter(int32 Index, const FOmegaGrid3D_PathParams& Params) const;
+
+	// A* search. OutPath includes both the start and goal coordinates.
+	bool FindPath(const FIntVector& Start, const FIntVector& Goal, const FOmegaGrid3D_PathParams& Params, TArray<FIntVector>& OutPath, float* OutCost=nullptr) const;
+	// Dijkstra flood fill of every tile reachable from Start for at most MaxCost. Includes the start tile.
+	void GetReachable(const FIntVector& Start, float MaxCost, const FOmegaGrid3D_PathParams& Params, TArray<FIntVector>& OutCoordinates, TArray<float>* OutCosts=nullptr) const;
+	// Runs GetReachable for each start in parallel.
+	void GetReachableBatch(const TArray<FIntVector>& Starts, float MaxCost, const FOmegaGrid3D_PathParams& Params, TArray<TArray<FIntVector>>& OutCoordinates) const;
+	// Walks the grid cells between the two coordinates and fails on the first tile that blocks line of effect.
+	bool HasLineOfEffect(const FIntVector& Start, const FIntVector& End) const;
+
+private:
+	void GetNeighbours(int32 Index, const FOmegaGrid3D_PathParams& Params, TArray<int32, TInlineAllocator<6>>& OutNeighbours) const;
+};
+
 // ===============================================================================================================================
 // Tilemap Component
 // ===============================================================================================================================
@@ -19,7 +95,23 @@ class OMEGAGAMEFRAMEWORK_API UOmegaGrid3D_Map : public USceneComponent
 	
 	UOmegaGrid3D_Map();
 
+	// Dense tile storage, indexed by GetTileIndex(). Size is GeneratedGridSize.X*GeneratedGridSize.Y*GeneratedGridSize.Z.
 	UPROPERTY() TArray<AOmegaGrid3D_Tile*> REF_Tiles;
+	// GridSize as of the last GenerateTiles. Tiles are indexed with this, so resizing GridSize only applies on the next generate.
+	FIntVector GeneratedGridSize=FIntVector::ZeroValue;
+
+	// Instanced tile data, indexed like REF_Tiles. Only used when bUseInstancedTiles is set.
+	UPROPERTY() TArray<UOmegaGrid3DTileType*> REF_TileTypes;
+	UPROPERTY() TArray<int32> REF_TileInstances;
+	UPROPERTY() TMap<UOmegaGrid3DTileType*, UInstancedStaticMeshComponent*> REF_TileMeshes;
+	// Tile index of each instance in a tile type's mesh, so a removed instance can be filled by the last one.
+	TMap<UOmegaGrid3DTileType*, TArray<int32>> REF_InstanceTiles;
+
+	AOmegaGrid3D_Tile* local_SpawnTileActor(FIntVector Coordinate, UOmegaGrid3DTileType* Type);
+	void local_GenerateInstancedTiles();
+	UInstancedStaticMeshComponent* local_GetTileMesh(UOmegaGrid3DTileType* Type);
+	FTransform local_GetTileTransform(FIntVector Coordinate);
+	void local_SetTileInstanceVisible(int32 TileIndex, bool bVisible);
 
 protected:
 	virtual void BeginPlay() override;
@@ -47,6 +139,19 @@ public:
 	FVector TileOffset;
 	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category="Grid3D")
 	TSubclassOf<AOmegaGrid3D_Tile> TileClass;
+
+	/*If true, tiles are stored as data and drawn with one instanced static mesh per tile type.
+	 *Tile actors are only spawned for tile types flagged "Spawn as Actor" or when promoted.*/
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Grid3D")
+	bool bUseInstancedTiles;
+
+	// Spawns a tile actor for an instanced tile and removes its instance, or returns the existing actor.
+	UFUNCTION(BlueprintCallable,Category="Grid3D")
+	AOmegaGrid3D_Tile* PromoteTileToActor(FIntVector Coordinate);
+	UFUNCTION(BlueprintPure,Category="Grid3D")
+	UOmegaGrid3DTileType* GetTileTypeAtCoordinate(FIntVector Coordinate);
+	UFUNCTION(BlueprintCallable,Category="Grid3D")
+	void SetTileTypeAtCoordinate(FIntVector Coordinate, UOmegaGrid3DTileType* Type);
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid3d|Preview")
 	FColor PreviewBoxColor = FColor::Cyan;  // Color of the debug box
@@ -65,6 +170,43 @@ public:
 	UFUNCTION(BlueprintPure,Category="Grid3D")
 	AOmegaGrid3D_Tile* GetTileFromCoordinate(FIntVector Coordinate);
 
+	// Coordinate Index. These use the size the tiles were generated with, not the current GridSize.
+	UFUNCTION(BlueprintPure,Category="Grid3D")
+	bool IsCoordinateInGrid(FIntVector Coordinate) const;
+	// Returns the flat index of a coordinate in the tile array, or INDEX_NONE if it is outside of the generated grid.
+	int32 GetTileIndex(FIntVector Coordinate) const;
+	FIntVector GetCoordinateFromIndex(int32 Index) const;
+
+	// Pathing
+	FOmegaGrid3D_CostGrid CostGrid;
+	// Rebuilds the cost grid from the current tiles. Called automatically after GenerateTiles.
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	void RefreshCostGrid();
+	void Native_UpdateTileCost(AOmegaGrid3D_Tile* Tile);
+	void Native_UpdateCostAtIndex(int32 TileIndex);
+	// Tile actors at each coordinate. Never promotes, so on instanced gridmaps tiles without an actor are skipped.
+	TArray<AOmegaGrid3D_Tile*> Native_GetTilesFromCoordinates(const TArray<FIntVector>& Coordinates);
+
+	// Tile versions. On instanced gridmaps these only return tiles that already have an actor, use the coordinate versions there.
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<AOmegaGrid3D_Tile*> FindPath(AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* Goal, FOmegaGrid3D_PathParams Params, bool& bFound, float& PathCost);
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<AOmegaGrid3D_Tile*> GetReachableTiles(AOmegaGrid3D_Tile* Origin, float MaxCost, FOmegaGrid3D_PathParams Params);
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<FOmegaGrid3D_TileList> GetReachableTilesBatch(TArray<AOmegaGrid3D_Tile*> Origins, float MaxCost, FOmegaGrid3D_PathParams Params);
+	UFUNCTION(BlueprintPure,Category="Grid3D|Pathing")
+	bool HasLineOfEffect(AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* End);
+
+	// Coordinate versions. These never spawn tile actors.
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<FIntVector> FindPathCoordinates(FIntVector Start, FIntVector Goal, FOmegaGrid3D_PathParams Params, bool& bFound, float& PathCost);
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<FIntVector> GetReachableCoordinates(FIntVector Origin, float MaxCost, FOmegaGrid3D_PathParams Params);
+	UFUNCTION(BlueprintCallable,Category="Grid3D|Pathing")
+	TArray<FOmegaGrid3D_CoordinateList> GetReachableCoordinatesBatch(TArray<FIntVector> Origins, float MaxCost, FOmegaGrid3D_PathParams Params);
+	UFUNCTION(BlueprintPure,Category="Grid3D|Pathing")
+	bool HasLineOfEffectBetweenCoordinates(FIntVector Start, FIntVector End);
+
 };
 
 UCLASS()
@@ -112,6 +254,9 @@ public:
 	
 	UFUNCTION(BlueprintCallable,Category="Grid3D")
 	void SetTile(AOmegaGrid3D_Tile* Tile, bool bClearPrevious=true, bool bSnap=true);
+	// Places the occupant on a coordinate, promoting an instanced tile to an actor so it is marked occupied for pathing.
+	UFUNCTION(BlueprintCallable,Category="Grid3D")
+	void SetTileAtCoordinate(UOmegaGrid3D_Map* Gridmap, FIntVector Coordinate, bool bClearPrevious=true, bool bSnap=true);
 	UFUNCTION(BlueprintCallable,Category="Grid3D")
 	AOmegaGrid3D_Tile* GetTile();
 };
@@ -164,7 +309,21 @@ class OMEGAGAMEFRAMEWORK_API UOmegaGrid3DTileType : public UPrimaryDataAsset
 	GENERATED_BODY()
 
 public:
-	
+
+	// Cost to move onto a tile of this type.
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Pathing",meta=(ClampMin="0.0"))
+	float MovementCost=1.0;
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Pathing")
+	bool bIsPassable=true;
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Pathing")
+	bool bBlocksLineOfEffect=false;
+
+	// Mesh used to draw this tile type when the gridmap uses instanced tiles.
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Instancing")
+	UStaticMesh* TileMesh;
+	// Tiles of this type always spawn a tile actor, even on instanced gridmaps.
+	UPROPERTY(EditAnywhere,BlueprintReadOnly,Category="Instancing")
+	bool bSpawnAsActor=false;
 };
 
 // =====================================================================================================
@@ -205,6 +364,9 @@ public:
 	UOmegaGrid3D_Map* GetOwningGridmap();	
 	UFUNCTION(BlueprintPure,Category="Grid3d Tile")
 	FIntVector GetTileCoordinate();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
 
 
@@ -221,4 +383,63 @@ public:
 	UPROPERTY() TArray<UOmegaGrid3D_Map*> REF_Tilemaps;
 	
 	UFUNCTION() void Register_TileMap(UOmegaGrid3D_Map* Tilemap, bool bRegistered);
-};
\ No newline at end of file
+
+	// Reverse lookup of the last tile each occupant was placed on.
+	UPROPERTY() TMap<UOmegaGrid3D_Occupant*, AOmegaGrid3D_Tile*> REF_OccupantTiles;
+
+	void Native_SetOccupantTile(UOmegaGrid3D_Occupant* Occupant, AOmegaGrid3D_Tile* Tile, bool bIsOnTile);
+	AOmegaGrid3D_Tile* Native_GetOccupantTile(UOmegaGrid3D_Occupant* Occupant) const;
+};
+
+// =====================================================================================================
+// Async Pathing
+// =====================================================================================================
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnGrid3DPathQueryComplete, const TArray<AOmegaGrid3D_Tile*>&, Tiles, const TArray<FIntVector>&, Coordinates, float, Cost);
+
+UCLASS()
+class OMEGAGAMEFRAMEWORK_API UAsyncAction_Grid3DPathQuery : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY() UOmegaGrid3D_Map* local_Gridmap;
+	UPROPERTY() AOmegaGrid3D_Tile* local_Start;
+	UPROPERTY() AOmegaGrid3D_Tile* local_Goal;
+	FIntVector local_StartCoord=FIntVector(INDEX_NONE);
+	FIntVector local_GoalCoord=FIntVector(INDEX_NONE);
+	float local_MaxCost=0;
+	bool local_bIsRangeQuery=false;
+	// Coordinate queries only report coordinates, so no tile actors are spawned for instanced gridmaps.
+	bool local_bCoordinatesOnly=false;
+	FOmegaGrid3D_PathParams local_Params;
+
+	void local_Finish(const TArray<FIntVector>& Coordinates, float Cost, bool bSuccess);
+
+public:
+
+	UPROPERTY(BlueprintAssignable)
+	FOnGrid3DPathQueryComplete Success;
+	UPROPERTY(BlueprintAssignable)
+	FOnGrid3DPathQueryComplete Failed;
+
+	virtual void Activate() override;
+
+	// Runs an A* search on a worker thread against a snapshot of the gridmap's cost grid.
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Grid3D|Pathing",
+		DisplayName="Ω🔷 Find Grid3D Path (Async)")
+	static UAsyncAction_Grid3DPathQuery* FindGrid3DPathAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap, AOmegaGrid3D_Tile* Start, AOmegaGrid3D_Tile* Goal, FOmegaGrid3D_PathParams Params);
+
+	// Flood fills every tile reachable within MaxCost on a worker thread.
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Grid3D|Pathing",
+		DisplayName="Ω🔷 Get Grid3D Reachable Tiles (Async)")
+	static UAsyncAction_Grid3DPathQuery* GetGrid3DReachableTilesAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap, AOmegaGrid3D_Tile* Origin, float MaxCost, FOmegaGrid3D_PathParams Params);
+
+	// Coordinate versions. Tiles is left empty, results are in Coordinates.
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Grid3D|Pathing",
+		DisplayName="Ω🔷 Find Grid3D Path (Coordinates, Async)")
+	static UAsyncAction_Grid3DPathQuery* FindGrid3DPathAsync_Coordinates(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap, FIntVector Start, FIntVector Goal, FOmegaGrid3D_PathParams Params);
+
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Grid3D|Pathing",
+		DisplayName="Ω🔷 Get Grid3D Reachable Coordinates (Async)")
+	static UAsyncAction_Grid3DPathQuery* GetGrid3DReachableCoordinatesAsync(UObject* WorldContextObject, UOmegaGrid3D_Map* Gridmap, FIntVector Origin, float MaxCost, FOmegaGrid3D_PathParams Params);
+};
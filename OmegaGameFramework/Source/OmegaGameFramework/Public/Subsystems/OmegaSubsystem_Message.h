@@ -8,6 +8,7 @@
 #include "EngineUtils.h"
 #include "GameplayTagContainer.h"
 #include "LuaInterface.h"
+#include "Misc/OmegaUtils_RingLog.h"
 #include "OmegaSubsystem_Message.generated.h"
 
 USTRUCT(BlueprintType, Atomic)
@@ -31,7 +32,8 @@ class OMEGAGAMEFRAMEWORK_API UOmegaMessageSubsystem : public UGameInstanceSubsys
 
 public:
 
-	//virtual void Initialize(FSubsystemCollectionBase& Colection) override;
+	virtual void Initialize(FSubsystemCollectionBase& Colection) override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
 	UFUNCTION(BlueprintCallable, Category="Omega|Gameplay Message")
 	void FireGameplayMessage(FOmegaGameplayMessageData Message);
@@ -42,8 +44,15 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnGameplayMessage OnGameplayMessage;
 	
-	UPROPERTY()
-	TArray<FOmegaGameplayMessageData> MessageLog;
+	// Bounded by MessageLogCapacity in settings. Logged messages are kept alive through AddReferencedObjects.
+	TOmegaRingLog<FOmegaGameplayMessageData, FGameplayTag> MessageLog;
+
+	// Oldest-first page of logged message texts. Leave the category empty for all messages. A Count of -1 reads to the end.
+	UFUNCTION(BlueprintPure, Category="Omega|Gameplay Message")
+	TArray<FText> GetMessageLogPage(FGameplayTag MessageCategory, int32 Start, int32 Count, int32& TotalEntries);
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Gameplay Message")
+	void ClearMessageLog() { MessageLog.Empty(); }
 
 };
 
@@ -0,0 +1,81 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+// Manages bullets for patterns with many shots: pools bullet actors for reuse and simulates data bullets in one batched update.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Actors/Actor_Bullet.h"
+#include "OmegaSubsystem_Projectile.generated.h"
+
+// A bullet without an actor. Moved by a sphere sweep every frame.
+USTRUCT()
+struct FOmegaDataBullet
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FVector Location = FVector::ZeroVector;
+	UPROPERTY() FVector Velocity = FVector::ZeroVector;
+	UPROPERTY() float GravityZ = 0.f;
+	UPROPERTY() float Radius = 0.f;
+	UPROPERTY() float RemainingLifetime = 0.f;
+	UPROPERTY() bool bCollides = true;
+	UPROPERTY() TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_WorldDynamic;
+	UPROPERTY() FCollisionResponseContainer CollisionResponses;
+	UPROPERTY() UCombatantComponent* Instigator = nullptr;
+	UPROPERTY() TSubclassOf<AOmegaGameplayCue> CueOnImpact;
+	UPROPERTY() FOmegaCustomScriptedEffects ImpactEffects;
+};
+
+USTRUCT()
+struct FOmegaBulletPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<AOmegaBulletActor*> Actors;
+};
+
+UCLASS(DisplayName="Omega Subsystem: Projectiles")
+class OMEGAGAMEFRAMEWORK_API UOmegaProjectileSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return DataBullets.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UOmegaProjectileSubsystem, STATGROUP_Tickables ); }
+	virtual bool IsTickableWhenPaused() const { return false; }
+	virtual bool IsTickableInEditor() const { return false; }
+	// FTickableGameObject End
+
+	virtual void Deinitialize() override;
+
+	// Returns a pooled bullet of the class if one is free, otherwise spawns a new one.
+	AOmegaBulletActor* Native_AcquireBullet(TSubclassOf<AOmegaBulletActor> Bullet, const FTransform& Origin, const FOmegaCustomScriptedEffects& Effects, UCombatantComponent* Instigator);
+	// Hides and deactivates the bullet and keeps it for reuse. Destroys it if the pool of its class is full.
+	void Native_ReleaseBullet(AOmegaBulletActor* Bullet);
+
+	// Adds a data bullet using the speed, radius, gravity and cues of the bullet class defaults.
+	void Native_SpawnDataBullet(TSubclassOf<AOmegaBulletActor> Bullet, const FTransform& Origin, const FOmegaCustomScriptedEffects& Effects, UCombatantComponent* Instigator);
+
+	UFUNCTION(BlueprintPure, Category="Omega|Bullets")
+	int32 GetActiveDataBulletCount() const { return DataBullets.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Bullets")
+	void ClearDataBullets();
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Bullets")
+	void EmptyBulletPools();
+
+private:
+	UPROPERTY()
+	TArray<FOmegaDataBullet> DataBullets;
+
+	UPROPERTY()
+	TMap<UClass*, FOmegaBulletPool> BulletPools;
+};
@@ -8,6 +8,7 @@
 #include "GameplayTags.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "OmegaSubsystem_QueueDelay.generated.h"
 
 UINTERFACE(MinimalAPI)
@@ -27,22 +28,70 @@ public:
 
 
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQueuedDelayChanged, FGameplayTag, Tag, bool, bActive);
+
 UCLASS()
-class OMEGAGAMEFRAMEWORK_API UOmegaSubsystem_QueueDelay : public UGameInstanceSubsystem
+class OMEGAGAMEFRAMEWORK_API UOmegaSubsystem_QueueDelay : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
-	UPROPERTY()
-	TArray<UObject*> DelaySources;
+	// Sources are held weakly, so a source that is destroyed without unregistering does not hold its tags forever.
+	TArray<TWeakObjectPtr<UObject>> DelaySources;
+
+	// Sources that did not opt into pushing their state. They are read on queries and polled while anything awaits a delay.
+	TArray<TWeakObjectPtr<UObject>> PolledSources;
+
+	// The delay tags each source last pushed.
+	TMap<TObjectKey<UObject>, FGameplayTagContainer> SourceDelayTags;
+
+	// Set after garbage collection, so the next query first releases the tags of collected sources.
+	bool bMayHaveStaleSources = false;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	void local_PollSources();
+	void local_PurgeStaleSources();
+	void local_SetSourceTags(const TObjectKey<UObject>& SourceKey, const FGameplayTagContainer& ActiveTags);
+
+	// How many sources currently hold each tag in delay.
+	TMap<FGameplayTag, int32> DelayTagCounts;
 
+	TMap<FGameplayTag, FSimpleMulticastDelegate> DelayReleasedDelegates;
 	
 public:
 
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject Begin
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return bMayHaveStaleSources || (PolledSources.Num() > 0 && DelayReleasedDelegates.Num() > 0); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UOmegaSubsystem_QueueDelay, STATGROUP_Tickables ); }
+	virtual bool IsTickableWhenPaused() const { return true; }
+	virtual bool IsTickableInEditor() const { return false; }
+	// FTickableGameObject End
+
+	UPROPERTY(BlueprintAssignable)
+	FOnQueuedDelayChanged OnQueuedDelayChanged;
+
 	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay")
 	bool IsTagInQueuedDelay(FGameplayTag Tag);
 	
+	//Sources that push their state must call UpdateQueuedDelaySource (or SetQueuedDelayTags) whenever it changes.
+	//Clear bPushesState for sources that compute their state on the fly; those are polled instead.
+	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay", meta=(AdvancedDisplay="bPushesState"))
+	bool SetQueuedDelaySourceRegistered(UObject* Source, bool bIsRegistered, bool bPushesState = true);
+
+	//Sets the tags a source currently holds in delay. Empty tags release the source's delay.
 	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay")
-	bool SetQueuedDelaySourceRegistered(UObject* Source, bool bIsRegistered);
+	void SetQueuedDelayTags(UObject* Source, FGameplayTagContainer ActiveTags);
+
+	//Reads the delay state of a source through its interface. Sources that push their state call this whenever it changes.
+	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay")
+	void UpdateQueuedDelaySource(UObject* Source);
+
+	// Broadcast once, when the last source releases the tag.
+	FSimpleMulticastDelegate& Native_OnQueuedDelayReleased(FGameplayTag Tag) { return DelayReleasedDelegates.FindOrAdd(Tag); }
 };
 
 
@@ -52,20 +101,13 @@ public:
 // ------------------------------------------------------------------------------------------------
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnQueuedDelayFinish);
 UCLASS()
-class OMEGAGAMEFRAMEWORK_API UAsyncAction_AwaitQueuedDelay : public UBlueprintAsyncActionBase, public FTickableGameObject
+class OMEGAGAMEFRAMEWORK_API UAsyncAction_AwaitQueuedDelay : public UBlueprintAsyncActionBase
 {
 	GENERATED_BODY()
 
 	void local_TryEnd();
 
 public:
-
-	virtual void Tick(float DeltaTime) override;
-	virtual ETickableTickType GetTickableTickType() const override {return ETickableTickType::Always; }
-	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( FMyTickableThing, STATGROUP_Tickables ); }
-	virtual bool IsTickableWhenPaused() const { return true; }
-	virtual bool IsTickableInEditor() const { return false; }
-	// FTickableGameObject End
 	
 	UPROPERTY(BlueprintAssignable)
 	FOnQueuedDelayFinish Finished;
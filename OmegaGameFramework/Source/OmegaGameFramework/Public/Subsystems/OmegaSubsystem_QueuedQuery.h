@@ -24,6 +24,8 @@ public:
 
 
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQueuedQueryBlockChanged, FGameplayTag, Tag, bool, bBlocked);
+
 UCLASS()
 class OMEGAGAMEFRAMEWORK_API UOmegaSubsystem_QueuedQuery : public UGameInstanceSubsystem
 {
@@ -32,8 +34,25 @@ class OMEGAGAMEFRAMEWORK_API UOmegaSubsystem_QueuedQuery : public UGameInstanceS
 	UPROPERTY()
 	TArray<UObject*> QuerySources;
 
+	// The tags each source last pushed as blocked.
+	UPROPERTY()
+	TMap<UObject*, FGameplayTagContainer> SourceBlockedTags;
+
+	// How many sources currently block each tag. Checked before any source is asked.
+	TMap<FGameplayTag, int32> BlockedTagCounts;
+
 public:
 
+	UPROPERTY(BlueprintAssignable)
+	FOnQueuedQueryBlockChanged OnQueuedQueryBlockChanged;
+
+	//Sets the tags a source currently blocks. Queries of a blocked tag fail without asking the registered sources.
+	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay")
+	void SetQueuedQueryBlockedTags(UObject* Source, FGameplayTagContainer BlockedTags);
+
+	UFUNCTION(BlueprintPure, Category="Omega|Queued Delay")
+	bool IsQueuedQueryBlocked(FGameplayTag Tag) const { return BlockedTagCounts.Contains(Tag); }
+
 	UFUNCTION(BlueprintCallable, Category="Omega|Queued Delay")
 	bool CheckQueuedQuery(FGameplayTag Tag, UObject* Context);
 	
@@ -15,6 +15,8 @@
 #include "Misc/Timespan.h"
 #include "GameFramework/SaveGame.h"
 #include "Misc/OmegaUtils_Structs.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Async/Future.h"
 #include "OmegaSubsystem_Save.generated.h"
 
 class UOmegaSaveBase;
@@ -73,6 +75,46 @@ public:
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewGameStarted, UOmegaSaveGame*, NewGame);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSaveStateChanged, FGameplayTag, NewState, bool, bGlobal);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSaveTagsEdited, FGameplayTagContainer, EditedTags, bool, Added, bool, bGlobal);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAsyncSaveFinished, const FString&, SlotName, bool, bSuccess);
+
+// Small summary of a game save, written next to it so save menus can list slots without loading the full save.
+USTRUCT(BlueprintType)
+struct FOmegaSaveSlotHeader
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Save") FString SlotName;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FText DisplayName;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FTimespan Playtime;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FDateTime SaveDate;
+	UPROPERTY(BlueprintReadOnly, Category="Save") TSoftObjectPtr<UOmegaZoneData> ActiveZone;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FString ActiveLevelName;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FGameplayTag SaveCategory;
+	UPROPERTY(BlueprintReadOnly, Category="Save") FString ScreenshotPath;
+
+	void SerializeHeader(FArchive& Ar);
+};
+
+// Save snapshots waiting to be written by the save worker. Shared with the worker so it can outlive the subsystem.
+struct FOmegaSaveWriteQueue
+{
+	struct FEntry
+	{
+		FString SlotName;
+		TArray<uint8> Data;
+		TArray<uint8> HeaderData;
+		TArray<TFunction<void(bool)>> Callbacks;
+		// Set for read jobs, which run in order with the writes instead of writing a slot.
+		TFunction<void()> ReadJob;
+	};
+
+	FCriticalSection QueueLock;
+	// Held for the whole write of a slot so sync and async writes never interleave.
+	FCriticalSection WriteLock;
+	TArray<FEntry> Entries;
+	bool bWorkerRunning = false;
+	TFuture<void> Worker;
+};
 
 UCLASS(DisplayName = "Omega Subsystem: Save")
 class OMEGAGAMEFRAMEWORK_API UOmegaSaveSubsystem : public UGameInstanceSubsystem
@@ -90,6 +132,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem")
 	TArray<UOmegaSaveGame*> GetSaveSlotList(int32 FirstIndex, int32 LastIndex = 1);
 
+	//Reads only the slot headers of the given range. Much faster than Get Save Slot List for populating save menus.
+	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem")
+	TArray<FOmegaSaveSlotHeader> GetSaveSlotHeaders(int32 FirstIndex, int32 LastIndex = 1);
+
+	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem")
+	bool GetSaveSlotHeader_Named(FString Slot, FOmegaSaveSlotHeader& Header);
+
+	//Loads the screenshot of a slot. Cached until the slot is saved again, so rows can call this as they become visible.
+	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem")
+	UTexture2D* GetSaveSlotScreenshot(const FOmegaSaveSlotHeader& Header);
+
+	//Reads the headers of every slot name, one after another. Slots without a readable header get the bytes of the full save instead.
+	//Call with the save write lock held, e.g. from a job queued with Native_EnqueueSaveRead.
+	static TArray<FOmegaSaveSlotHeader> Native_ReadSaveSlotHeaders(const TArray<FString>& SlotNames, TArray<TArray<uint8>>& OutLegacySaves);
+	//Keeps the headers that were read, and builds headers for legacy saves from their full save bytes. Game thread only.
+	TArray<FOmegaSaveSlotHeader> Native_ResolveSaveSlotHeaders(const TArray<FString>& SlotNames, const TArray<FOmegaSaveSlotHeader>& ReadHeaders, const TArray<TArray<uint8>>& LegacySaves);
+	//Runs the job on the save worker, after the queued writes and with the write lock held.
+	void Native_EnqueueSaveRead(TFunction<void()>&& Job);
+
 	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem|Load",DisplayName="Load Game Object (From Slot)")
 	UOmegaSaveGame* LoadGame(int32 Slot, bool& Success);
 	
@@ -122,6 +183,23 @@ public:
 	
 	UFUNCTION()
 	bool Local_SaveGame(FString SlotName,FGameplayTag SaveCategory);
+
+	//Gathers the active game on the game thread, then compresses and writes it to the slot on a worker thread. Saves are written in the order they were requested.
+	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem",DisplayName="Save Active Game Async (To Slot)")
+	void SaveActiveGameAsync(int32 Slot,FGameplayTag SaveCategory);
+
+	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem",DisplayName="Save Active Game Async (To Name)")
+	void SaveActiveGameAsync_Named(FString Slot,FGameplayTag SaveCategory);
+
+	void Native_SaveActiveGameAsync(const FString& SlotName, FGameplayTag SaveCategory, TFunction<void(bool)> OnComplete = nullptr);
+
+	UFUNCTION(BlueprintPure, Category = "Omega|SaveSubsystem")
+	bool IsAsyncSaveInProgress() const;
+
+	//Blocks until every queued async save has been written.
+	void FlushAsyncSaves();
+
+	UPROPERTY(BlueprintAssignable) FOnAsyncSaveFinished OnAsyncSaveFinished;
 	
 	UFUNCTION(BlueprintCallable, Category = "Omega|SaveSubsystem")
 		UOmegaSaveGame* CreateNewGame();
@@ -137,6 +215,13 @@ public:
 private:
 
 	void Local_InitializeSaveObjects();
+	FOmegaSaveSlotHeader local_SnapshotActiveGame(const FString& SlotName, FGameplayTag SaveCategory);
+	void local_EnqueueSaveWrite(const FString& SlotName, TArray<uint8>&& Data, TArray<uint8>&& HeaderData, TFunction<void(bool)>&& OnComplete);
+	//Starts the save worker if it is not running. Call with the queue lock held.
+	void local_StartSaveWorker();
+	FOmegaSaveSlotHeader local_MakeHeaderFromSave(const FString& SlotName, UOmegaSaveGame* Save);
+	UPROPERTY() TMap<FString, UTexture2D*> REF_ScreenshotCache;
+	TSharedRef<FOmegaSaveWriteQueue, ESPMode::ThreadSafe> SaveWriteQueue = MakeShared<FOmegaSaveWriteQueue, ESPMode::ThreadSafe>();
 	void local_SaveLuaFields(TArray<FString> fields, UOmegaSaveBase* save);
 	void local_LoadLuaFields(TArray<FString> fields, UOmegaSaveBase* save);
 	
@@ -327,7 +412,7 @@ public:
 	//###############################################################################################
 	// Screenshot
 	//###############################################################################################
-	FString Local_GetScreenshotPath(FString SlotName)
+	static FString Local_GetScreenshotPath(FString SlotName)
 	{
 		FString fileName = FPaths::ProjectSavedDir();
 		fileName = fileName + "/SaveGames/" + SlotName + ".png";
@@ -772,4 +857,60 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category="State Script")
 	void OnLevelChange(UOmegaSaveSubsystem* SaveSubsystem, UOmegaStoryStateAsset* State, const FString& LevelName);
 	
-};
\ No newline at end of file
+};
+
+
+// ====================================================================================================
+// Async Save
+// ====================================================================================================
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAsyncSaveGameComplete);
+
+UCLASS()
+class OMEGAGAMEFRAMEWORK_API UAsyncAction_SaveActiveGame : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY() UOmegaSaveSubsystem* local_Subsystem;
+	FString local_SlotName;
+	FGameplayTag local_SaveCategory;
+
+public:
+
+	UPROPERTY(BlueprintAssignable)
+	FOnAsyncSaveGameComplete Saved;
+	UPROPERTY(BlueprintAssignable)
+	FOnAsyncSaveGameComplete Failed;
+
+	virtual void Activate() override;
+
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Omega|SaveSubsystem",
+		DisplayName="Ω🔷 Save Active Game (Async)")
+	static UAsyncAction_SaveActiveGame* SaveActiveGameAsync(UObject* WorldContextObject, int32 Slot, FGameplayTag SaveCategory);
+
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Omega|SaveSubsystem",
+		DisplayName="Ω🔷 Save Active Game (Async, Named)")
+	static UAsyncAction_SaveActiveGame* SaveActiveGameAsync_Named(UObject* WorldContextObject, FString Slot, FGameplayTag SaveCategory);
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSaveSlotHeadersLoaded, const TArray<FOmegaSaveSlotHeader>&, Headers);
+
+UCLASS()
+class OMEGAGAMEFRAMEWORK_API UAsyncAction_GetSaveSlotHeaders : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+	TArray<FString> local_SlotNames;
+	TWeakObjectPtr<UOmegaSaveSubsystem> local_SaveSubsystem;
+
+public:
+
+	UPROPERTY(BlueprintAssignable)
+	FOnSaveSlotHeadersLoaded Loaded;
+
+	virtual void Activate() override;
+
+	// Reads the slot headers of the given range on the save worker.
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly = "true", WorldContext="WorldContextObject"), Category="Omega|SaveSubsystem",
+		DisplayName="Ω🔷 Get Save Slot Headers (Async)")
+	static UAsyncAction_GetSaveSlotHeaders* GetSaveSlotHeadersAsync(UObject* WorldContextObject, int32 FirstIndex, int32 LastIndex = 1);
+};
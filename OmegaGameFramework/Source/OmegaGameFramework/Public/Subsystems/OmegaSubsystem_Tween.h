@@ -0,0 +1,90 @@
+// Copyright Studio Syndicat 2021. All Rights Reserved.
+
+// Evaluates all active tweens and timed waits in one pass per frame, instead of one tickable object per async node or widget.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Curves/CurveFloat.h"
+#include "OmegaSubsystem_Tween.generated.h"
+
+USTRUCT()
+struct FOmegaTween
+{
+	GENERATED_BODY()
+
+	int32 Handle = INDEX_NONE;
+
+	// If set, the update value is sampled from the curve. Otherwise it is the linear alpha of Time/EndTime.
+	UPROPERTY() UCurveFloat* Curve = nullptr;
+	UPROPERTY() float Time = 0.f;
+	// The tween finishes once Time reaches EndTime, or 0 if reversed. Negative if the tween only ends on its FinishCondition.
+	UPROPERTY() float EndTime = 1.f;
+	UPROPERTY() float PlayRate = 1.f;
+	UPROPERTY() bool bReversed = false;
+
+	UPROPERTY() FName PauseGroup;
+	UPROPERTY() bool bTickWhenPaused = false;
+	UPROPERTY() bool bUseTimeDilation = true;
+	TWeakObjectPtr<UWorld> World;
+	// The tween is dropped without finishing once its owner is gone.
+	TWeakObjectPtr<UObject> Owner;
+
+	TFunction<void(float)> OnUpdate;
+	TFunction<void()> OnFinished;
+	// Checked every frame instead of the update, for waits that end on a condition.
+	TFunction<bool()> FinishCondition;
+
+	bool bDone = false;
+};
+
+UCLASS(DisplayName="Omega Subsystem: Tweens")
+class OMEGAGAMEFRAMEWORK_API UOmegaTweenSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return Tweens.Num() > 0 || PendingTweens.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT( UOmegaTweenSubsystem, STATGROUP_Tickables ); }
+	virtual bool IsTickableWhenPaused() const { return true; }
+	virtual bool IsTickableInEditor() const { return false; }
+	// FTickableGameObject End
+
+	virtual void Deinitialize() override;
+
+	// Starts a tween and returns its handle.
+	int32 Native_AddTween(FOmegaTween&& Tween);
+	// Calls OnFinished once Condition returns true. The condition is checked once per frame, even while paused.
+	int32 Native_WaitUntil(UObject* Owner, TFunction<bool()> Condition, TFunction<void()> OnFinished);
+	// Stops a tween without calling its finish callback.
+	void Native_CancelTween(int32 Handle);
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Tweens")
+	void SetTweenGroupPaused(FName PauseGroup, bool bPaused);
+
+	UFUNCTION(BlueprintPure, Category="Omega|Tweens")
+	bool IsTweenGroupPaused(FName PauseGroup) const { return PausedGroups.Contains(PauseGroup); }
+
+	UFUNCTION(BlueprintPure, Category="Omega|Tweens")
+	int32 GetActiveTweenCount() const { return Tweens.Num() + PendingTweens.Num(); }
+
+private:
+	UPROPERTY()
+	TArray<FOmegaTween> Tweens;
+
+	// Tweens added while ticking. Kept apart so callbacks never reallocate the array being ticked.
+	UPROPERTY()
+	TArray<FOmegaTween> PendingTweens;
+
+	UPROPERTY()
+	TSet<FName> PausedGroups;
+
+	bool bIsTicking = false;
+	int32 NextTweenHandle = 0;
+};
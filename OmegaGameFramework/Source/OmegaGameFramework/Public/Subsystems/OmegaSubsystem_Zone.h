@@ -17,6 +17,7 @@
 #include "Components/TextRenderComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "Engine/StreamableManager.h"
 
 #include "OmegaSubsystem_Zone.generated.h"
 
@@ -26,12 +27,67 @@ class UBrushComponent;
 class UBillboardComponent;
 class UBoxComponent;
 class UOmegaZoneSubsystem;
+class ULevelStreaming;
+class UOmegaZoneData;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlaySpawnedAtPoint, APlayerController*, Player, AOmegaZonePoint*, Point);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnZoneLoaded, UOmegaZoneData*, Zone);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnZoneUnloaded, UOmegaZoneData*, Zone);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnZoneTransitInRange, AOmegaZoneTransit*, ZoneTransit, bool, bInRange);
 
+// One streaming level load or unload issued by a zone load task.
+USTRUCT()
+struct FOmegaZoneStreamRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FName Level;
+	UPROPERTY() int32 Priority = 0;
+	UPROPERTY() ULevelStreaming* Streaming = nullptr;
+	double RequestTime = 0.0;
+};
+
+// A streamed level kept loaded but hidden ahead of a likely transit.
+USTRUCT()
+struct FOmegaZonePrefetchLevel
+{
+	GENERATED_BODY()
+
+	UPROPERTY() ULevelStreaming* Streaming = nullptr;
+	//Transits currently in range that want this level
+	UPROPERTY() TArray<UObject*> Sources;
+	int64 Bytes = 0;
+	double ReleaseTime = 0.0;
+};
+
+USTRUCT(BlueprintType)
+struct FOmegaZoneTraceEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Zone")
+	FString Label;
+	//Seconds since the transit began
+	UPROPERTY(BlueprintReadOnly, Category="Zone")
+	float Time = 0.0;
+};
+
+// Timeline of one zone transit, from LoadZone to the end of the fade in.
+USTRUCT(BlueprintType)
+struct FOmegaZoneTransitTrace
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Zone")
+	UOmegaZoneData* Zone = nullptr;
+	UPROPERTY(BlueprintReadOnly, Category="Zone")
+	TArray<FOmegaZoneTraceEvent> Events;
+	UPROPERTY(BlueprintReadOnly, Category="Zone")
+	float TotalTime = 0.0;
+	
+	double StartTime = 0.0;
+};
+
 // =============================================================================================================
 // Zone Entity
 // =============================================================================================================
@@ -171,6 +227,10 @@ public:
 	UFUNCTION(BlueprintPure, Category="Omega|Zone")
 	bool IsZoneLoaded(UOmegaZoneData* Zone);
 
+	//Timing of the last completed zone transit. Also written to the log when the transit completes.
+	UFUNCTION(BlueprintPure, Category="Omega|Zone")
+	FOmegaZoneTransitTrace GetLastZoneTransitTrace() const { return LastTransitTrace; }
+
 	UPROPERTY(BlueprintAssignable)
 	FOnZoneLoaded OnZoneLoaded;
 	UPROPERTY(BlueprintAssignable)
@@ -190,6 +250,27 @@ public:
 	UFUNCTION(BlueprintPure, Category="Omega|Zone")
 	UOmegaLevelData* GetCurrentLevelData();
 
+	//Package name of a level with any PIE prefix removed. Used as the key for level data lookups.
+	static FName GetLevelPackageName(const TSoftObjectPtr<UWorld>& SoftLevelReference);
+
+	//----------------------------------------------------------------------------------------------------------------
+	// Prefetch
+	//----------------------------------------------------------------------------------------------------------------
+
+	//Starts loading the streamed levels of a zone without showing them, so a transit to it only has to make them visible. Kept loaded while the source holds it, then evicted as the prefetch budget needs room.
+	UFUNCTION(BlueprintCallable, Category="Omega|Zone")
+	void PrefetchZone(UOmegaZoneData* Zone, UObject* Source);
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Zone")
+	void ReleaseZonePrefetch(UOmegaZoneData* Zone, UObject* Source);
+
+	//Starts loading the level data of another level ahead of a level transit. Loaded level data stays cached for the session.
+	UFUNCTION(BlueprintCallable, Category="Omega|Zone")
+	void PrefetchLevelData(TSoftObjectPtr<UWorld> Level);
+
+	UFUNCTION(BlueprintCallable, Category="Omega|Zone")
+	void ReleaseLevelDataPrefetch(TSoftObjectPtr<UWorld> Level);
+
 	UFUNCTION(BlueprintPure, Category="Omega|Zone")
 	TSoftObjectPtr<UWorld> GetCurrentLevelSoftReference();
 	
@@ -268,13 +349,29 @@ protected:
 	UPROPERTY() UOmegaZoneData* IncomingZone_Load;
 	UPROPERTY() AOmegaZonePoint* Incoming_SpawnPoint;
 	UPROPERTY() UOmegaZoneData* IncomingZone_Unload;
-	UPROPERTY() TArray<FName> Incoming_LoadList;
 	UPROPERTY() bool Incoming_LoadState;
 	UPROPERTY() UOmegaZoneData* Incoming_LoadTaskZone;
+
+	// Requests not yet issued, highest priority first
+	UPROPERTY() TArray<FOmegaZoneStreamRequest> Incoming_LoadQueue;
+	// Requests issued and waiting on the streaming level
+	UPROPERTY() TArray<FOmegaZoneStreamRequest> Incoming_InFlight;
+	UPROPERTY() bool bIsLoadTaskActive;
 	
-	UFUNCTION() void Local_OnBeginLoadTaskList(TArray<FName> Levels, bool Loaded);
+	UFUNCTION() void Local_OnBeginLoadTaskList(UOmegaZoneData* Zone, TArray<FName> Levels, bool Loaded);
 	UFUNCTION() void Local_OnNextLoadEvent();
 	UFUNCTION() void Local_OnFinishLoadTask(bool LoadState);
+	bool Local_IsStreamRequestDone(const FOmegaZoneStreamRequest& Request) const;
+
+	UPROPERTY() TMap<FName, FOmegaZonePrefetchLevel> PrefetchedLevels;
+	int64 PrefetchedBytes = 0;
+	bool Local_IsLevelInLoadedZone(FName Level) const;
+	void Local_EvictPrefetchedLevel(FName Level);
+
+	UPROPERTY() FOmegaZoneTransitTrace ActiveTransitTrace;
+	UPROPERTY() FOmegaZoneTransitTrace LastTransitTrace;
+	void Local_TraceTransit(const FString& Label);
+	void Local_FinishTransitTrace();
 
 	UPROPERTY() FName IncomingLevelName;
 	UPROPERTY() bool Local_IsWaitForLoad;
@@ -367,6 +464,10 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Zone")
 	TArray<FName> StreamedLevels;
+
+	//Streamed levels with a higher priority are requested first and get a higher async loading priority. Unlisted levels use 0. Put gameplay-critical levels above cosmetic ones.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Zone")
+	TMap<FName, int32> StreamedLevelPriorities;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Zone")
 	TArray<FActorDataLayer> DataLayers;
@@ -458,6 +559,14 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn")
 	UOmegaZoneData* SpawnZoneToLoad;
+
+	//Starts loading the destination while the player is inside the notify box, so the transit itself only has to show it.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Zone")
+	bool bPrefetchOnNotify = true;
+
+	//The zone a transit from here would load, if any.
+	UFUNCTION(BlueprintPure, Category="Zone")
+	UOmegaZoneData* GetDestinationZone() const;
 	
 protected:
 	void UpdateBoxes();
@@ -473,6 +582,10 @@ protected:
 
 	UFUNCTION()
 	void OnBoxNotifyOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	bool IsPlayerPawn(AActor* Actor) const;
+	void SetPrefetchActive(bool bActive);
+	UPROPERTY() UOmegaZoneData* PrefetchedZone = nullptr;
 };
 
 // =============================================================================================================
@@ -531,6 +644,35 @@ public:
 	
 	UPROPERTY() FGameplayTag TargetSpawnPointTag;
 	UPROPERTY() TSoftObjectPtr<UWorld> PreviousLevel;
+
+	//----------------------------------------------------------------------------------------------------------------
+	// Level Data
+	//----------------------------------------------------------------------------------------------------------------
+	// Lives here so loaded level data survives level changes.
+
+	//Returns the level data if it is already loaded. Never loads.
+	UOmegaLevelData* Native_FindLevelData(FName LevelPackage) const { return LevelDataCache.FindRef(LevelPackage); }
+
+	//Loads the level data asynchronously. OnLoaded is called right away if it is already loaded, and with null if the level has none.
+	void Native_RequestLevelData(FName LevelPackage, TFunction<void(UOmegaLevelData*)>&& OnLoaded = nullptr);
+	void Native_CancelLevelDataRequest(FName LevelPackage);
+
+	//Blocking fallback for callers that cannot wait.
+	UOmegaLevelData* Native_LoadLevelDataNow(FName LevelPackage);
+
+	//Asset path of a level's data, from the asset registry. Falls back to the <Level>_WorldData naming convention.
+	FSoftObjectPath GetLevelDataAssetPath(FName LevelPackage);
+
+private:
+	void Local_BuildLevelDataPaths();
+	void Local_OnLevelDataLoaded(FName LevelPackage);
+
+	FStreamableManager StreamableManager;
+	UPROPERTY() TMap<FName, UOmegaLevelData*> LevelDataCache;
+	TMap<FName, FSoftObjectPath> LevelDataPaths;
+	TMap<FName, TSharedPtr<FStreamableHandle>> PendingLevelData;
+	TMap<FName, TArray<TFunction<void(UOmegaLevelData*)>>> PendingLevelDataCallbacks;
+	bool bLevelDataPathsBuilt = false;
 };
 
 
@@ -21,6 +21,7 @@ class SConstraintCanvas;
 class UPanelWidget;
 class UPrimaryDataAsset;
 class UDataWidget;
+class USpacer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnEntrySelected, UDataWidget*, Entry, FString, Label, UObject*, Asset, int32, Index);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnEntryHovered, UDataWidget*, Entry, FString, Label, UObject*, Asset, int32, Index);
@@ -41,6 +42,26 @@ enum class EDataListFormat : uint8
 };
 
 
+USTRUCT()
+struct FDataWidgetPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UDataWidget*> Widgets;
+};
+
+USTRUCT()
+struct FDataListVirtualEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UObject* Asset = nullptr;
+	UPROPERTY()
+	FString Flag;
+};
+
 UCLASS(BlueprintType, Blueprintable, Abstract, editinlinenew, CollapseCategories)
 class OMEGAGAMEFRAMEWORK_API UDataListCustomEntry : public UObject, public IDataInterface_General
 {
@@ -143,6 +164,76 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Entry")
 	void RefreshAllEntries();
 
+	//###########################################
+	// Virtualization
+	//###########################################
+
+	//Only creates entry widgets for the assets inside the visible window. Assets outside the window are kept as data and bound to recycled entries as the window moves.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="List|Virtualization")
+	bool bVirtualizeEntries;
+
+	//Number of entries created at once while virtualized. For uniform grids this should be a multiple of the grid max value.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="List|Virtualization", meta=(EditCondition="bVirtualizeEntries", ClampMin="1"))
+	int32 VirtualWindowSize = 12;
+
+	//Recycles removed entry widgets instead of destroying them. Always on while virtualized.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="List|Virtualization")
+	bool bPoolEntries;
+
+	//Index of the first asset shown while virtualized.
+	UPROPERTY(BlueprintReadOnly, Category="List|Virtualization")
+	int32 VirtualWindowStart;
+
+	//Length of one entry along a virtualized scroll box, used to size the space standing in for assets outside the window. 0 measures the first entry.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="List|Virtualization", meta=(EditCondition="bVirtualizeEntries", ClampMin="0"))
+	float VirtualEntryExtent;
+
+	UFUNCTION(BlueprintCallable, Category="Ω|Widget|DataList")
+	void SetVirtualWindowStart(int32 NewStart);
+
+	//Number of assets in the list, including assets not currently shown by a virtualized list.
+	UFUNCTION(BlueprintPure, Category="Ω|Widget|DataList")
+	int32 GetNumListedAssets() const;
+
+private:
+	UPROPERTY()
+	TArray<FDataListVirtualEntry> VirtualEntries;
+	UPROPERTY()
+	TMap<TSubclassOf<UDataWidget>, FDataWidgetPool> EntryPool;
+	//Scroll box spacers standing in for the assets before and after the virtual window.
+	UPROPERTY()
+	USpacer* VirtualLeadSpacer;
+	UPROPERTY()
+	USpacer* VirtualTrailSpacer;
+	float VirtualMeasuredExtent = 0;
+	//Initialized entry that runs Is Entity Hidden before an asset is added. Handed to the next added entry.
+	UPROPERTY()
+	UDataWidget* FilterEntry;
+	bool bFilterEntryRecycled = false;
+
+	bool local_UsesPool() const { return bVirtualizeEntries || bPoolEntries; }
+	bool local_CanAddAsset(UObject* Asset);
+	UDataWidget* local_AcquireEntry(bool& bRecycled);
+	void local_InitEntry(UDataWidget* Entry);
+	void local_ReleaseEntry(UDataWidget* Entry);
+	void local_PlaceEntry(UDataWidget* Entry);
+	UDataWidget* local_AddEntryWidget(UObject* Asset, const FString& Flag);
+	void local_RefreshVirtualWindow();
+	void local_ScrollVirtualWindowTo(int32 Index);
+	int32 local_GetListIndex(UDataWidget* Entry) const;
+	void local_GetGridPosition(int32 Index, int32& Row, int32& Column) const;
+	void local_RebuildListPanelSlate();
+	void local_FlushListPanelSlate();
+	bool bListPanelSlatePending = false;
+	void local_AddListPanelToCanvas();
+	void local_RestoreHoverIndex(UObject* HoveredAsset);
+	bool local_UsesVirtualScroll() const;
+	float local_GetVirtualEntryExtent();
+	void local_UpdateVirtualSpacers();
+	UFUNCTION()
+	void local_OnListUserScrolled(float CurrentOffset);
+public:
+
 	UPROPERTY(EditAnywhere,BlueprintReadOnly="Entry")
 	bool bCanOverrideSize;
 	UPROPERTY(EditAnywhere,BlueprintReadOnly="Entry",meta=(EditCondition="bCanOverrideSize"))
@@ -193,6 +284,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ω|Widget|DataList", meta=(AdvancedDisplay="Flag"))
 	TArray<UDataWidget*> AddAssetsToList(TArray<UObject*> Assets, FString Flag, bool ClearListFirst=true);
 
+	//Updates the list to match the given assets, keeping the entries of assets that are still listed and only adding, removing or moving what changed. The hovered entry is kept if its asset is still listed.
+	UFUNCTION(BlueprintCallable, Category = "Ω|Widget|DataList", meta=(AdvancedDisplay="Flag,bRefreshKeptEntries"))
+	TArray<UDataWidget*> SyncAssetsToList(TArray<UObject*> Assets, FString Flag, bool bRefreshKeptEntries=false);
+
 	UFUNCTION(BlueprintCallable, Category = "Ω|Widget|DataList", meta=(AdvancedDisplay="Flag"))
 	UDataWidget* AddedCustomEntryToList(FCustomAssetData EntryData, FString Flag);
 
@@ -228,6 +323,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ω|Widget|DataList")
 	bool CycleEntry(int32 Amount, int32& NewEntry);
 
+	//Entry indices are list indices, counting every listed asset. A virtualized list has no entry for assets outside its window.
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "Ω|Widget|DataList")
 	int32 GetEntryIndex(UDataWidget* Entry);
 	
@@ -8,28 +8,15 @@
 
 
 UCLASS()
-class OMEGAGAMEFRAMEWORK_API UDynamicProgressMeter : public UImage, public FTickableGameObject
+class OMEGAGAMEFRAMEWORK_API UDynamicProgressMeter : public UImage
 {
 	GENERATED_BODY()
 
-	virtual void Tick(float DeltaTime) override;
-	
-	virtual ETickableTickType GetTickableTickType() const override
-	{
-		return ETickableTickType::Always;
-	}
-	virtual TStatId GetStatId() const override
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT( FMyTickableThing, STATGROUP_Tickables );
-	}
-	virtual bool IsTickableWhenPaused() const
-	{
-		return false;
-	}
-	virtual bool IsTickableInEditor() const
-	{
-		return false;
-	}
+	// The ghost interpolation runs as a tween only while the ghost is catching up.
+	void local_StartGhostInterp();
+	void local_SetGhostValue(float value);
+
+	int32 GhostTweenHandle = INDEX_NONE;
 
 public:
 	virtual void OnWidgetRebuilt() override;